@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:40 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+# include <algorithm>
+# include <cstddef>
+# include <cstdio>
+# include <pthread.h>
+# include <sched.h>
+# include <time.h>
+# include <vector>
+
+/**
+ * @brief Small helpers shared by the benchmark mains in this directory: a monotonic clock, a
+ * deterministic random generator, latency percentiles and a way to start N threads together.
+ * Every benchmark prints one line per measured configuration, `make bench` runs them all.
+ */
+
+namespace bench
+{
+    // Nanoseconds on the monotonic clock
+    inline unsigned long long now_ns()
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<unsigned long long>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+    }
+
+    class timer
+    {
+    public:
+        timer() : start_(now_ns())
+        {
+        }
+
+        double seconds() const
+        {
+            return (now_ns() - start_) / 1e9;
+        }
+
+    private:
+        unsigned long long start_;
+    };
+
+    // xorshift64*, the same sequence on every run
+    class rng
+    {
+    public:
+        explicit rng(unsigned long long seed = 88172645463325252ULL) : state_(seed ? seed : 1)
+        {
+        }
+
+        unsigned long long next()
+        {
+            state_ ^= state_ >> 12;
+            state_ ^= state_ << 25;
+            state_ ^= state_ >> 27;
+            return state_ * 2685821657736338717ULL;
+        }
+
+        // Uniform in [0, bound)
+        std::size_t below(std::size_t bound)
+        {
+            return static_cast<std::size_t>(next() % bound);
+        }
+
+    private:
+        unsigned long long state_;
+    };
+
+    // Throughput line: name, operations per second and total time
+    inline void report(const char *name, std::size_t ops, double seconds)
+    {
+        std::printf("%-48s %10.2f Mops/s %10.2f ms\n", name, ops / seconds / 1e6, seconds * 1e3);
+    }
+
+    // Latency line from per-operation samples in nanoseconds, sorts the samples
+    inline void report_latency(const char *name, std::vector<unsigned long long> &samples)
+    {
+        if (samples.empty())
+            return;
+        std::sort(samples.begin(), samples.end());
+        std::size_t n = samples.size();
+        std::printf("%-48s p50 %7llu ns  p99 %7llu ns  p99.9 %7llu ns  max %9llu ns\n", name,
+                    samples[n / 2], samples[n * 99 / 100], samples[n * 999 / 1000], samples[n - 1]);
+    }
+
+    /**
+     * @brief Runs fn(arg, index) on `threads` threads released at the same time and returns the
+     * wall time from the release to the last thread finishing.
+     */
+    template <typename Arg>
+    class thread_group
+    {
+    public:
+        typedef void (*function_type)(Arg &, std::size_t);
+
+        static double run(std::size_t threads, function_type fn, Arg &arg)
+        {
+            thread_group group(fn, arg);
+            std::vector<pthread_t> handles(threads);
+            std::vector<start_info> infos(threads);
+            for (std::size_t i = 0; i < threads; ++i)
+            {
+                infos[i].group = &group;
+                infos[i].index = i;
+                pthread_create(&handles[i], NULL, &thread_group::start, &infos[i]);
+            }
+            while (__atomic_load_n(&group.ready_, __ATOMIC_ACQUIRE) != threads)
+                sched_yield();
+            timer t;
+            __atomic_store_n(&group.go_, 1, __ATOMIC_RELEASE);
+            for (std::size_t i = 0; i < threads; ++i)
+                pthread_join(handles[i], NULL);
+            return t.seconds();
+        }
+
+    private:
+        struct start_info
+        {
+            thread_group *group;
+            std::size_t index;
+        };
+
+        thread_group(function_type fn, Arg &arg) : fn_(fn), arg_(arg), ready_(0), go_(0)
+        {
+        }
+
+        static void *start(void *p)
+        {
+            start_info *info = static_cast<start_info *>(p);
+            thread_group &group = *info->group;
+            __atomic_fetch_add(&group.ready_, 1, __ATOMIC_ACQ_REL);
+            while (__atomic_load_n(&group.go_, __ATOMIC_ACQUIRE) == 0)
+                sched_yield();
+            group.fn_(group.arg_, info->index);
+            return NULL;
+        }
+
+    private:
+        function_type fn_;
+        Arg &arg_;
+        std::size_t ready_;
+        int go_;
+    };
+
+    // Keeps the optimizer from dropping a computed value
+    template <typename T>
+    inline void do_not_optimize(const T &value)
+    {
+        __asm__ __volatile__("" : : "r"(&value) : "memory");
+    }
+} // namespace bench
+
+#endif
\ No newline at end of file
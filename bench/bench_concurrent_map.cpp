@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_concurrent_map.cpp                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:31:05 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 09:31:05 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+
+#include "bench.hpp"
+#include "concurrent_map.hpp"
+#include "map.hpp"
+#include "mutex.hpp"
+
+// ft::concurrent_map against an ft::map behind one mutex, over reader/writer ratios and thread
+// counts. Every thread runs the same mix: write_per_mille of its operations are writes
+// (assign or erase), the rest are lookups.
+
+namespace
+{
+    const std::size_t key_range = 100000;
+    const std::size_t ops_per_thread = 200000;
+
+    struct config
+    {
+        unsigned write_per_mille;
+        ft::concurrent_map<int, int> *cmap;
+        ft::map<int, int> *locked_map;
+        ft::mutex *lock;
+    };
+
+    void run_concurrent(config &cfg, std::size_t index)
+    {
+        bench::rng rng(index + 1);
+        long found = 0;
+        for (std::size_t i = 0; i < ops_per_thread; ++i)
+        {
+            int key = static_cast<int>(rng.below(key_range));
+            if (rng.below(1000) < cfg.write_per_mille)
+            {
+                if (i & 1)
+                    cfg.cmap->erase(key);
+                else
+                    cfg.cmap->assign(key, static_cast<int>(i));
+            }
+            else
+            {
+                int value;
+                found += cfg.cmap->find(key, value);
+            }
+        }
+        bench::do_not_optimize(found);
+    }
+
+    void run_locked(config &cfg, std::size_t index)
+    {
+        bench::rng rng(index + 1);
+        long found = 0;
+        for (std::size_t i = 0; i < ops_per_thread; ++i)
+        {
+            int key = static_cast<int>(rng.below(key_range));
+            ft::lock_guard<ft::mutex> guard(*cfg.lock);
+            if (rng.below(1000) < cfg.write_per_mille)
+            {
+                if (i & 1)
+                    cfg.locked_map->erase(key);
+                else
+                    (*cfg.locked_map)[key] = static_cast<int>(i);
+            }
+            else
+                found += cfg.locked_map->count(key);
+        }
+        bench::do_not_optimize(found);
+    }
+}
+
+int main()
+{
+    const unsigned ratios[] = {0, 10, 100, 500};
+    const std::size_t thread_counts[] = {1, 2, 4, 8};
+
+    for (std::size_t r = 0; r < sizeof(ratios) / sizeof(ratios[0]); ++r)
+    {
+        for (std::size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t)
+        {
+            std::size_t threads = thread_counts[t];
+            char name[64];
+
+            ft::concurrent_map<int, int> cmap(256);
+            ft::map<int, int> locked_map;
+            ft::mutex lock;
+            for (std::size_t k = 0; k < key_range; k += 2)
+            {
+                cmap.insert(ft::make_pair(static_cast<int>(k), 0));
+                locked_map.insert(ft::make_pair(static_cast<int>(k), 0));
+            }
+            cmap.publish();
+
+            config cfg = {ratios[r], &cmap, &locked_map, &lock};
+            double seconds = bench::thread_group<config>::run(threads, &run_concurrent, cfg);
+            std::snprintf(name, sizeof(name), "concurrent_map  writes %4.1f%% threads %zu",
+                          ratios[r] / 10.0, threads);
+            bench::report(name, threads * ops_per_thread, seconds);
+
+            seconds = bench::thread_group<config>::run(threads, &run_locked, cfg);
+            std::snprintf(name, sizeof(name), "mutex + ft::map writes %4.1f%% threads %zu",
+                          ratios[r] / 10.0, threads);
+            bench::report(name, threads * ops_per_thread, seconds);
+        }
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_concurrent_stack.cpp                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:24:09 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 15:24:09 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+
+#include "bench.hpp"
+#include "concurrent_stack.hpp"
+#include "mutex.hpp"
+#include "stack.hpp"
+
+// Contention on one shared LIFO over 1 to 8 threads: ft::concurrent_stack against ft::stack
+// behind an ft::mutex. Each thread pushes and pops in turn, the free-list pattern, so every
+// operation hits the top of the stack.
+
+namespace
+{
+    const std::size_t pairs_per_thread = 500000;
+    const std::size_t prefill = 1024;
+
+    struct config
+    {
+        ft::concurrent_stack<int> *lock_free;
+        ft::stack<int> *locked_stack;
+        ft::mutex *lock;
+    };
+
+    void run_lock_free(config &cfg, std::size_t index)
+    {
+        long sum = 0;
+        int value;
+        for (std::size_t i = 0; i < pairs_per_thread; ++i)
+        {
+            cfg.lock_free->push(static_cast<int>(index + i));
+            if (cfg.lock_free->try_pop(value))
+                sum += value;
+        }
+        bench::do_not_optimize(sum);
+    }
+
+    void run_locked(config &cfg, std::size_t index)
+    {
+        long sum = 0;
+        for (std::size_t i = 0; i < pairs_per_thread; ++i)
+        {
+            {
+                ft::lock_guard<ft::mutex> guard(*cfg.lock);
+                cfg.locked_stack->push(static_cast<int>(index + i));
+            }
+            ft::lock_guard<ft::mutex> guard(*cfg.lock);
+            if (!cfg.locked_stack->empty())
+            {
+                sum += cfg.locked_stack->top();
+                cfg.locked_stack->pop();
+            }
+        }
+        bench::do_not_optimize(sum);
+    }
+}
+
+int main()
+{
+    const std::size_t thread_counts[] = {1, 2, 4, 8};
+
+    for (std::size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t)
+    {
+        std::size_t threads = thread_counts[t];
+        char name[64];
+
+        ft::concurrent_stack<int> lock_free;
+        ft::stack<int> locked_stack;
+        ft::mutex lock;
+        for (std::size_t i = 0; i < prefill; ++i)
+        {
+            lock_free.push(static_cast<int>(i));
+            locked_stack.push(static_cast<int>(i));
+        }
+        config cfg = {&lock_free, &locked_stack, &lock};
+
+        double seconds = bench::thread_group<config>::run(threads, &run_lock_free, cfg);
+        std::snprintf(name, sizeof(name), "concurrent_stack push/pop threads %zu", threads);
+        bench::report(name, threads * pairs_per_thread * 2, seconds);
+
+        seconds = bench::thread_group<config>::run(threads, &run_locked, cfg);
+        std::snprintf(name, sizeof(name), "mutex + ft::stack push/pop threads %zu", threads);
+        bench::report(name, threads * pairs_per_thread * 2, seconds);
+    }
+    return 0;
+}
\ No newline at end of file
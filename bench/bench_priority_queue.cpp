@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_priority_queue.cpp                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:58:30 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 15:58:30 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "bench.hpp"
+#include "priority_queue.hpp"
+
+// ft::priority_queue's 4-ary heap against binary heaps: the same class with Arity 2, and
+// std::priority_queue, all as min-heaps. Push then pop a million random keys, and a timer-wheel
+// style loop that keeps the heap at a fixed size by replacing the earliest deadline with a later
+// one (pop_push for ft, pop + push for std).
+
+namespace
+{
+    const std::size_t element_count = 1000000;
+    const std::size_t scheduler_size = 100000;
+    const std::size_t scheduler_steps = element_count;
+
+    typedef std::greater<unsigned long long> later;
+
+    template <typename Queue>
+    void replace_top(Queue &q, unsigned long long value)
+    {
+        q.pop_push(value);
+    }
+
+    template <>
+    void replace_top(std::priority_queue<unsigned long long, std::vector<unsigned long long>, later> &q, unsigned long long value)
+    {
+        q.pop();
+        q.push(value);
+    }
+
+    template <typename Queue>
+    void run(const char *label, const std::vector<unsigned long long> &keys)
+    {
+        char name[64];
+        unsigned long long sum = 0;
+
+        Queue q;
+        bench::timer push_timer;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            q.push(keys[i]);
+        std::snprintf(name, sizeof(name), "%-28s push", label);
+        bench::report(name, keys.size(), push_timer.seconds());
+
+        bench::timer pop_timer;
+        while (!q.empty())
+        {
+            sum += q.top();
+            q.pop();
+        }
+        std::snprintf(name, sizeof(name), "%-28s pop", label);
+        bench::report(name, keys.size(), pop_timer.seconds());
+
+        for (std::size_t i = 0; i < scheduler_size; ++i)
+            q.push(keys[i]);
+        bench::timer scheduler_timer;
+        for (std::size_t i = 0; i < scheduler_steps; ++i)
+        {
+            const unsigned long long top = q.top();
+            sum += top;
+            replace_top(q, top + keys[i] % (1ULL << 40) + 1);
+        }
+        std::snprintf(name, sizeof(name), "%-28s replace top", label);
+        bench::report(name, scheduler_steps, scheduler_timer.seconds());
+        bench::do_not_optimize(sum);
+    }
+}
+
+int main()
+{
+    bench::rng rng;
+    std::vector<unsigned long long> keys(element_count);
+    for (std::size_t i = 0; i < element_count; ++i)
+        keys[i] = rng.next();
+
+    run<ft::priority_queue<unsigned long long, ft::vector<unsigned long long>, later, 4> >("ft::priority_queue arity 4", keys);
+    run<ft::priority_queue<unsigned long long, ft::vector<unsigned long long>, later, 2> >("ft::priority_queue arity 2", keys);
+    run<std::priority_queue<unsigned long long, std::vector<unsigned long long>, later> >("std::priority_queue", keys);
+    return 0;
+}
\ No newline at end of file
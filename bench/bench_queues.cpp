@@ -0,0 +1,200 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_queues.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:27:14 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 16:27:14 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <algorithm>
+#include <cstdio>
+#include <sched.h>
+#include <vector>
+
+#include "bench.hpp"
+#include "deque.hpp"
+#include "mpmc_queue.hpp"
+#include "mutex.hpp"
+#include "spsc_queue.hpp"
+
+// Throughput and latency of the bounded queues across thread counts: ft::spsc_queue with one
+// producer and one consumer, one element and batches of 32 at a time, and ft::mpmc_queue and an
+// ft::deque behind an ft::mutex with 1 to 4 producer/consumer pairs. Every element carries its
+// push time, so the consumers also sample push-to-pop latency.
+
+namespace
+{
+    const std::size_t items_per_producer = 200000;
+    const std::size_t capacity = 1024;
+    const std::size_t batch = 32;
+
+    typedef unsigned long long stamp_type;
+
+    // Bounded like the lock-free queues, so producers cannot run ahead of the consumers
+    class locked_queue
+    {
+    public:
+        explicit locked_queue(std::size_t bound) : bound_(bound)
+        {
+        }
+
+        bool try_push(const stamp_type &value)
+        {
+            ft::lock_guard<ft::mutex> guard(lock_);
+            if (items_.size() == bound_)
+                return false;
+            items_.push_back(value);
+            return true;
+        }
+
+        bool try_pop(stamp_type &out)
+        {
+            ft::lock_guard<ft::mutex> guard(lock_);
+            if (items_.empty())
+                return false;
+            out = items_.front();
+            items_.pop_front();
+            return true;
+        }
+
+    private:
+        std::size_t bound_;
+        ft::mutex lock_;
+        ft::deque<stamp_type> items_;
+    };
+
+    template <typename Queue>
+    struct config
+    {
+        Queue *queue;
+        std::vector<std::vector<stamp_type> > latencies; // One per thread, consumers fill theirs
+    };
+
+    // Nothing to do: on a busy machine the other side may be waiting for this core
+    inline void back_off()
+    {
+        ft::cpu_relax();
+        sched_yield();
+    }
+
+    template <typename Queue>
+    void produce(config<Queue> &cfg)
+    {
+        for (std::size_t i = 0; i < items_per_producer; ++i)
+        {
+            while (!cfg.queue->try_push(bench::now_ns()))
+                back_off();
+        }
+    }
+
+    template <typename Queue>
+    void consume(config<Queue> &cfg, std::vector<stamp_type> &latencies)
+    {
+        stamp_type value;
+        for (std::size_t i = 0; i < items_per_producer; ++i)
+        {
+            while (!cfg.queue->try_pop(value))
+                back_off();
+            latencies.push_back(bench::now_ns() - value);
+        }
+    }
+
+    template <typename Queue>
+    void produce_batches(config<Queue> &cfg)
+    {
+        stamp_type stamps[batch];
+        for (std::size_t done = 0; done < items_per_producer;)
+        {
+            const std::size_t want = std::min(batch, items_per_producer - done);
+            const stamp_type now = bench::now_ns();
+            for (std::size_t i = 0; i < want; ++i)
+                stamps[i] = now;
+            std::size_t pushed = 0;
+            while ((pushed += cfg.queue->push_n(stamps + pushed, want - pushed)) != want)
+                back_off();
+            done += want;
+        }
+    }
+
+    template <typename Queue>
+    void consume_batches(config<Queue> &cfg, std::vector<stamp_type> &latencies)
+    {
+        stamp_type stamps[batch];
+        for (std::size_t done = 0; done < items_per_producer;)
+        {
+            const std::size_t got = cfg.queue->pop_n(stamps, std::min(batch, items_per_producer - done));
+            if (got == 0)
+            {
+                back_off();
+                continue;
+            }
+            const stamp_type now = bench::now_ns();
+            for (std::size_t i = 0; i < got; ++i)
+                latencies.push_back(now - stamps[i]);
+            done += got;
+        }
+    }
+
+    // Even indices produce, odd ones consume
+    template <typename Queue>
+    void run_single(config<Queue> &cfg, std::size_t index)
+    {
+        if (index % 2 == 0)
+            produce(cfg);
+        else
+            consume(cfg, cfg.latencies[index]);
+    }
+
+    template <typename Queue>
+    void run_batches(config<Queue> &cfg, std::size_t index)
+    {
+        if (index % 2 == 0)
+            produce_batches(cfg);
+        else
+            consume_batches(cfg, cfg.latencies[index]);
+    }
+
+    template <typename Queue>
+    void run(const char *label, std::size_t pairs, typename bench::thread_group<config<Queue> >::function_type fn)
+    {
+        Queue queue(capacity);
+        config<Queue> cfg;
+        cfg.queue = &queue;
+        cfg.latencies.resize(pairs * 2);
+        for (std::size_t i = 1; i < cfg.latencies.size(); i += 2)
+            cfg.latencies[i].reserve(items_per_producer);
+
+        const double seconds = bench::thread_group<config<Queue> >::run(pairs * 2, fn, cfg);
+
+        std::vector<stamp_type> latencies;
+        for (std::size_t i = 1; i < cfg.latencies.size(); i += 2)
+            latencies.insert(latencies.end(), cfg.latencies[i].begin(), cfg.latencies[i].end());
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "%-20s %zu+%zu threads", label, pairs, pairs);
+        bench::report(name, pairs * items_per_producer, seconds);
+        bench::report_latency(name, latencies);
+    }
+}
+
+int main()
+{
+    typedef ft::spsc_queue<stamp_type> spsc;
+    typedef ft::mpmc_queue<stamp_type> mpmc;
+
+    run<spsc>("spsc_queue", 1, &run_single<spsc>);
+    run<spsc>("spsc_queue batch 32", 1, &run_batches<spsc>);
+
+    const std::size_t pair_counts[] = {1, 2, 4};
+    for (std::size_t p = 0; p < sizeof(pair_counts) / sizeof(pair_counts[0]); ++p)
+    {
+        run<mpmc>("mpmc_queue", pair_counts[p], &run_single<mpmc>);
+        run<mpmc>("mpmc_queue batch 32", pair_counts[p], &run_batches<mpmc>);
+        run<locked_queue>("mutex + ft::deque", pair_counts[p], &run_single<locked_queue>);
+    }
+    return 0;
+}
\ No newline at end of file
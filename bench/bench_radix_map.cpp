@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_radix_map.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:36:44 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 12:36:44 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "radix_map.hpp"
+
+// ft::radix_map against ft::map: random unsigned integer keys, and URL-like string keys that
+// share long prefixes, where the radix tree compares no key twice.
+
+namespace
+{
+    const std::size_t element_count = 200000;
+
+    template <typename Map, typename Key>
+    void run(const char *label, const std::vector<Key> &keys, const std::vector<Key> &probes)
+    {
+        char name[64];
+        Map m;
+
+        bench::timer insert_timer;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+        std::snprintf(name, sizeof(name), "%-28s insert", label);
+        bench::report(name, keys.size(), insert_timer.seconds());
+
+        long found = 0;
+        bench::timer find_timer;
+        for (std::size_t i = 0; i < probes.size(); ++i)
+            found += m.find(probes[i]) != m.end();
+        std::snprintf(name, sizeof(name), "%-28s find", label);
+        bench::report(name, probes.size(), find_timer.seconds());
+
+        bench::timer iterate_timer;
+        for (typename Map::iterator it = m.begin(); it != m.end(); ++it)
+            found += it->second;
+        std::snprintf(name, sizeof(name), "%-28s iterate", label);
+        bench::report(name, m.size(), iterate_timer.seconds());
+
+        bench::timer erase_timer;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            m.erase(keys[i]);
+        std::snprintf(name, sizeof(name), "%-28s erase", label);
+        bench::report(name, keys.size(), erase_timer.seconds());
+        bench::do_not_optimize(found);
+    }
+}
+
+int main()
+{
+    bench::rng rng;
+
+    std::vector<unsigned int> ints;
+    std::vector<unsigned int> int_probes;
+    for (std::size_t i = 0; i < element_count; ++i)
+    {
+        ints.push_back(static_cast<unsigned int>(rng.next()));
+        int_probes.push_back(i % 2 ? ints[rng.below(ints.size())] : static_cast<unsigned int>(rng.next()));
+    }
+    run<ft::radix_map<unsigned int, int>, unsigned int>("radix_map<unsigned int>", ints, int_probes);
+    run<ft::map<unsigned int, int>, unsigned int>("map<unsigned int>", ints, int_probes);
+
+    const char *const hosts[] = {"https://www.example.com/", "https://docs.example.org/",
+                                 "https://cdn.example.net/static/"};
+    std::vector<std::string> urls;
+    std::vector<std::string> url_probes;
+    for (std::size_t i = 0; i < element_count; ++i)
+    {
+        char path[64];
+        std::snprintf(path, sizeof(path), "section-%llu/page-%llu.html",
+                      static_cast<unsigned long long>(rng.below(100)),
+                      static_cast<unsigned long long>(rng.next() % 1000000));
+        urls.push_back(std::string(hosts[i % 3]) + path);
+    }
+    for (std::size_t i = 0; i < element_count; ++i)
+        url_probes.push_back(urls[rng.below(urls.size())]);
+    run<ft::radix_map<std::string, int>, std::string>("radix_map<string> URLs", urls, url_probes);
+    run<ft::map<std::string, int>, std::string>("map<string> URLs", urls, url_probes);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_sharded_map.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:02:17 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 10:02:17 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "mutex.hpp"
+#include "sharded_map.hpp"
+
+// Threaded insert throughput into a map<int, int>: ft::sharded_map against one ft::map behind a
+// mutex. Every thread inserts its own disjoint run of shuffled keys.
+
+namespace
+{
+    const std::size_t inserts_per_thread = 100000;
+
+    struct config
+    {
+        ft::sharded_map<int, int> *sharded;
+        ft::map<int, int> *locked_map;
+        ft::mutex *lock;
+    };
+
+    int key_for(std::size_t thread, std::size_t i)
+    {
+        // Spreads consecutive i over the key space without repeating inside one thread
+        return static_cast<int>(thread * inserts_per_thread + (i * 7919) % inserts_per_thread);
+    }
+
+    void run_sharded(config &cfg, std::size_t index)
+    {
+        for (std::size_t i = 0; i < inserts_per_thread; ++i)
+            cfg.sharded->insert(ft::make_pair(key_for(index, i), static_cast<int>(i)));
+    }
+
+    void run_locked(config &cfg, std::size_t index)
+    {
+        for (std::size_t i = 0; i < inserts_per_thread; ++i)
+        {
+            ft::lock_guard<ft::mutex> guard(*cfg.lock);
+            cfg.locked_map->insert(ft::make_pair(key_for(index, i), static_cast<int>(i)));
+        }
+    }
+}
+
+int main()
+{
+    const std::size_t thread_counts[] = {1, 2, 4, 8};
+
+    for (std::size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t)
+    {
+        std::size_t threads = thread_counts[t];
+        char name[64];
+
+        ft::sharded_map<int, int> sharded;
+        ft::map<int, int> locked_map;
+        ft::mutex lock;
+        config cfg = {&sharded, &locked_map, &lock};
+
+        double seconds = bench::thread_group<config>::run(threads, &run_sharded, cfg);
+        std::snprintf(name, sizeof(name), "sharded_map<16> insert threads %zu", threads);
+        bench::report(name, threads * inserts_per_thread, seconds);
+
+        seconds = bench::thread_group<config>::run(threads, &run_locked, cfg);
+        std::snprintf(name, sizeof(name), "mutex + ft::map insert threads %zu", threads);
+        bench::report(name, threads * inserts_per_thread, seconds);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_static_map.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:48:09 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 11:48:09 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+#include <vector>
+
+#include "bench.hpp"
+#include "flat_map.hpp"
+#include "map.hpp"
+#include "static_map.hpp"
+
+// Random lookups in ft::static_map (Eytzinger order) against ft::map and ft::flat_map (binary
+// search over a sorted array), from a size that fits in L1 to one well past the last level cache.
+
+namespace
+{
+    const std::size_t lookups = 1000000;
+
+    template <typename Map>
+    void run(const char *label, const Map &m, const std::vector<int> &probes, std::size_t size)
+    {
+        char name[64];
+        long found = 0;
+        bench::timer t;
+        for (std::size_t i = 0; i < probes.size(); ++i)
+            found += m.count(probes[i]);
+        std::snprintf(name, sizeof(name), "%-16s find, %7zu keys", label, size);
+        bench::report(name, probes.size(), t.seconds());
+        bench::do_not_optimize(found);
+    }
+}
+
+int main()
+{
+    const std::size_t sizes[] = {1000, 64000, 1000000};
+
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        const std::size_t size = sizes[s];
+        ft::map<int, int> tree;
+        ft::flat_map<int, int> flat;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            tree.insert(ft::make_pair(static_cast<int>(2 * i), static_cast<int>(i)));
+            flat.insert(ft::make_pair(static_cast<int>(2 * i), static_cast<int>(i)));
+        }
+        ft::static_map<int, int> eytzinger(tree);
+
+        // Half hits (even keys), half misses
+        bench::rng rng(size);
+        std::vector<int> probes;
+        for (std::size_t i = 0; i < lookups; ++i)
+            probes.push_back(static_cast<int>(rng.below(2 * size)));
+
+        run("ft::static_map", eytzinger, probes, size);
+        run("ft::flat_map", flat, probes, size);
+        run("ft::map", tree, probes, size);
+    }
+    return 0;
+}
\ No newline at end of file
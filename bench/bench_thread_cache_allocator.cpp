@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_thread_cache_allocator.cpp                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:58:21 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 14:58:21 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+#include <functional>
+#include <memory>
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "thread_cache_allocator.hpp"
+
+// Multi-threaded allocation churn: ft::thread_cache_allocator against std::allocator over 1 to 8
+// threads. Raw churn allocates and frees windows of map-node-sized blocks; map churn runs
+// insert/erase cycles of a per-thread ft::map, which is how the allocator is meant to be used.
+
+namespace
+{
+    const std::size_t blocks_per_thread = 2000000;
+    const std::size_t window = 64;
+    const std::size_t map_ops_per_thread = 400000;
+    const std::size_t map_keys = 4096;
+
+    struct node_sized
+    {
+        void *links[4];
+        int key;
+        int value;
+    };
+
+    struct config
+    {
+    };
+
+    template <typename Alloc>
+    void raw_churn(config &, std::size_t)
+    {
+        Alloc alloc;
+        typename Alloc::pointer held[window];
+        for (std::size_t done = 0; done < blocks_per_thread; done += window)
+        {
+            for (std::size_t i = 0; i < window; ++i)
+                held[i] = alloc.allocate(1);
+            for (std::size_t i = window; i-- > 0;)
+                alloc.deallocate(held[i], 1);
+        }
+    }
+
+    template <typename Alloc>
+    void map_churn(config &, std::size_t index)
+    {
+        typedef typename Alloc::template rebind<ft::pair<const int, int> >::other pair_allocator;
+        ft::map<int, int, std::less<int>, pair_allocator> m;
+        bench::rng rng(index + 1);
+        for (std::size_t i = 0; i < map_ops_per_thread; ++i)
+        {
+            const int key = static_cast<int>(rng.below(map_keys));
+            if (m.erase(key) == 0)
+                m.insert(ft::make_pair(key, key));
+        }
+        bench::do_not_optimize(m.size());
+    }
+
+    template <typename Alloc>
+    void run(const char *label, std::size_t threads)
+    {
+        config cfg;
+        char name[64];
+
+        double seconds = bench::thread_group<config>::run(threads, &raw_churn<Alloc>, cfg);
+        std::snprintf(name, sizeof(name), "%-22s raw churn threads %zu", label, threads);
+        bench::report(name, threads * blocks_per_thread * 2, seconds);
+
+        seconds = bench::thread_group<config>::run(threads, &map_churn<Alloc>, cfg);
+        std::snprintf(name, sizeof(name), "%-22s map churn threads %zu", label, threads);
+        bench::report(name, threads * map_ops_per_thread, seconds);
+    }
+}
+
+int main()
+{
+    const std::size_t thread_counts[] = {1, 2, 4, 8};
+
+    for (std::size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t)
+    {
+        run<ft::thread_cache_allocator<node_sized> >("thread_cache_allocator", thread_counts[t]);
+        run<std::allocator<node_sized> >("std::allocator", thread_counts[t]);
+    }
+    return 0;
+}
\ No newline at end of file
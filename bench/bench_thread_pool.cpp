@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_thread_pool.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:41:53 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 15:41:53 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+#include <vector>
+
+#include "bench.hpp"
+#include "thread_pool.hpp"
+
+// Scaling of ft::thread_pool on fine-grained recursive tasks: fib(n) where every call above a small
+// cutoff spawns one half as a task and runs the other itself, so tasks are a few hundred
+// nanoseconds of work and spawn/steal overhead dominates. Also parallel_for with a grain of one
+// index over a cheap body. Pools of 1 to 8 threads, against plain sequential calls.
+
+namespace
+{
+    const unsigned int fib_n = 32;
+    const unsigned int fib_cutoff = 10;
+    const std::size_t loop_count = 1000000;
+
+    unsigned long fib_sequential(unsigned int n)
+    {
+        return n < 2 ? n : fib_sequential(n - 1) + fib_sequential(n - 2);
+    }
+
+    struct fib_task
+    {
+        ft::thread_pool *pool;
+        unsigned int n;
+        unsigned long *out;
+
+        fib_task(ft::thread_pool *p, unsigned int value, unsigned long *result)
+            : pool(p), n(value), out(result)
+        {
+        }
+
+        void operator()() const
+        {
+            if (n < fib_cutoff)
+            {
+                *out = fib_sequential(n);
+                return;
+            }
+            unsigned long left;
+            unsigned long right;
+            ft::task_group group(*pool);
+            group.spawn(fib_task(pool, n - 1, &left));
+            fib_task(pool, n - 2, &right)();
+            group.wait();
+            *out = left + right;
+        }
+    };
+
+    struct square_into
+    {
+        unsigned long *out;
+
+        explicit square_into(unsigned long *values) : out(values)
+        {
+        }
+
+        void operator()(std::size_t i) const
+        {
+            out[i] = static_cast<unsigned long>(i) * i;
+        }
+    };
+
+    // fib calls made by fib_sequential(n), the task count bound of the recursive run
+    unsigned long fib_calls(unsigned int n)
+    {
+        return n < 2 ? 1 : 1 + fib_calls(n - 1) + fib_calls(n - 2);
+    }
+}
+
+int main()
+{
+    const std::size_t thread_counts[] = {1, 2, 4, 8};
+    const unsigned long calls = fib_calls(fib_n);
+    char name[64];
+
+    bench::timer sequential_timer;
+    unsigned long expected = fib_sequential(fib_n);
+    std::snprintf(name, sizeof(name), "sequential fib(%u)", fib_n);
+    bench::report(name, calls, sequential_timer.seconds());
+
+    std::vector<unsigned long> values(loop_count);
+    const square_into body(&values[0]);
+    bench::timer loop_timer;
+    for (std::size_t i = 0; i < loop_count; ++i)
+        body(i);
+    bench::report("sequential loop", loop_count, loop_timer.seconds());
+
+    for (std::size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); ++t)
+    {
+        ft::thread_pool pool(static_cast<unsigned int>(thread_counts[t]));
+
+        unsigned long result = 0;
+        bench::timer fib_timer;
+        fib_task(&pool, fib_n, &result)();
+        std::snprintf(name, sizeof(name), "task_group fib(%u) threads %zu", fib_n, thread_counts[t]);
+        bench::report(name, calls, fib_timer.seconds());
+        if (result != expected)
+            std::printf("fib mismatch: %lu != %lu\n", result, expected);
+
+        bench::timer for_timer;
+        pool.parallel_for(0, loop_count, body, 1);
+        std::snprintf(name, sizeof(name), "parallel_for grain 1 threads %zu", thread_counts[t]);
+        bench::report(name, loop_count, for_timer.seconds());
+    }
+    bench::do_not_optimize(values[loop_count - 1]);
+    return 0;
+}
\ No newline at end of file
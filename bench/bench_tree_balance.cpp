@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_tree_balance.cpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:02:37 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 14:02:37 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "bench.hpp"
+#include "map.hpp"
+
+// The four ft::map balance policies on the same three workloads: insert-heavy (80% insert,
+// 10% erase, 10% find from an empty map), lookup-heavy (95% find on a prefilled map), and
+// Zipf-skewed lookups, where a few hot keys take most of the probes: the case splay_balance
+// is meant for.
+
+namespace
+{
+    const std::size_t key_space = 200000;
+    const std::size_t op_count = 400000;
+    const double zipf_exponent = 1.0;
+
+    enum op_kind
+    {
+        op_insert,
+        op_erase,
+        op_find
+    };
+
+    struct op
+    {
+        op_kind kind;
+        int key;
+    };
+
+    // Draws ranks 0..n-1 with probability proportional to 1 / (rank + 1)^s by binary search
+    // over the cumulative weights, then scatters the ranks over the key space
+    class zipf
+    {
+    public:
+        zipf(std::size_t n, double s) : cdf_(n)
+        {
+            double sum = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                sum += 1.0 / std::pow(static_cast<double>(i + 1), s);
+                cdf_[i] = sum;
+            }
+            for (std::size_t i = 0; i < n; ++i)
+                cdf_[i] /= sum;
+        }
+
+        int draw(bench::rng &rng) const
+        {
+            const double u = static_cast<double>(rng.next() >> 11) / 9007199254740992.0;
+            std::size_t lo = 0;
+            std::size_t hi = cdf_.size() - 1;
+            while (lo < hi)
+            {
+                const std::size_t mid = lo + (hi - lo) / 2;
+                if (cdf_[mid] < u)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return static_cast<int>((lo * 2654435761UL) % cdf_.size());
+        }
+
+    private:
+        std::vector<double> cdf_;
+    };
+
+    std::vector<op> mixed_ops(bench::rng &rng, unsigned insert_pct, unsigned erase_pct)
+    {
+        std::vector<op> ops(op_count);
+        for (std::size_t i = 0; i < op_count; ++i)
+        {
+            const std::size_t roll = rng.below(100);
+            ops[i].kind = roll < insert_pct ? op_insert : roll < insert_pct + erase_pct ? op_erase : op_find;
+            ops[i].key = static_cast<int>(rng.below(key_space));
+        }
+        return ops;
+    }
+
+    std::vector<op> zipf_ops(bench::rng &rng)
+    {
+        const zipf dist(key_space, zipf_exponent);
+        std::vector<op> ops(op_count);
+        for (std::size_t i = 0; i < op_count; ++i)
+        {
+            ops[i].kind = op_find;
+            ops[i].key = dist.draw(rng);
+        }
+        return ops;
+    }
+
+    template <typename Balance>
+    void run(const char *policy, const char *workload, bool prefill, const std::vector<op> &ops)
+    {
+        typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, Balance> map_type;
+
+        map_type m;
+        if (prefill)
+            for (std::size_t i = 0; i < key_space; i += 2)
+                m.insert(ft::make_pair(static_cast<int>((i * 2654435761UL) % key_space), 0));
+
+        long found = 0;
+        bench::timer timer;
+        for (std::size_t i = 0; i < ops.size(); ++i)
+        {
+            switch (ops[i].kind)
+            {
+            case op_insert:
+                m.insert(ft::make_pair(ops[i].key, 0));
+                break;
+            case op_erase:
+                m.erase(ops[i].key);
+                break;
+            case op_find:
+                found += m.find(ops[i].key) != m.end();
+                break;
+            }
+        }
+        const double seconds = timer.seconds();
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "%-14s %s", policy, workload);
+        bench::report(name, ops.size(), seconds);
+        bench::do_not_optimize(found);
+    }
+
+    void run_workload(const char *workload, bool prefill, const std::vector<op> &ops)
+    {
+        run<ft::rb_balance>("rb_balance", workload, prefill, ops);
+        run<ft::avl_balance>("avl_balance", workload, prefill, ops);
+        run<ft::treap_balance>("treap_balance", workload, prefill, ops);
+        run<ft::splay_balance>("splay_balance", workload, prefill, ops);
+    }
+}
+
+int main()
+{
+    bench::rng rng;
+
+    run_workload("insert-heavy", false, mixed_ops(rng, 80, 10));
+    run_workload("lookup-heavy", true, mixed_ops(rng, 3, 2));
+    run_workload("zipf-skewed", true, zipf_ops(rng));
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_tree_iteration.cpp                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:05:33 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 11:05:33 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+#include <vector>
+
+#include "bench.hpp"
+#include "map.hpp"
+
+// Iteration over ft::map. The bench target builds this file twice: as is, where iterators climb
+// parent links, and with FT_TREE_THREADED, where they follow the in-order links. Inserts and
+// erases are timed too, since the threaded build maintains two more links per node.
+
+namespace
+{
+#ifdef FT_TREE_THREADED
+    const char *const variant = "threaded";
+#else
+    const char *const variant = "parent links";
+#endif
+
+    const std::size_t element_count = 200000;
+    const std::size_t passes = 20;
+    const std::size_t range_scans = 20000;
+    const std::size_t range_length = 64;
+}
+
+int main()
+{
+    typedef ft::map<int, int> map_type;
+    char name[64];
+    bench::rng rng;
+    std::vector<int> keys;
+    for (std::size_t i = 0; i < element_count; ++i)
+        keys.push_back(static_cast<int>(rng.next() & 0x3fffffff));
+
+    map_type m;
+    bench::timer insert_timer;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+    std::snprintf(name, sizeof(name), "map insert            (%s)", variant);
+    bench::report(name, keys.size(), insert_timer.seconds());
+
+    long sum = 0;
+    bench::timer forward_timer;
+    for (std::size_t p = 0; p < passes; ++p)
+        for (map_type::const_iterator it = m.begin(); it != m.end(); ++it)
+            sum += it->second;
+    std::snprintf(name, sizeof(name), "map forward iteration (%s)", variant);
+    bench::report(name, passes * m.size(), forward_timer.seconds());
+
+    bench::timer reverse_timer;
+    for (std::size_t p = 0; p < passes; ++p)
+        for (map_type::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it)
+            sum += it->second;
+    std::snprintf(name, sizeof(name), "map reverse iteration (%s)", variant);
+    bench::report(name, passes * m.size(), reverse_timer.seconds());
+
+    bench::timer range_timer;
+    for (std::size_t i = 0; i < range_scans; ++i)
+    {
+        map_type::const_iterator it = m.lower_bound(static_cast<int>(rng.next() & 0x3fffffff));
+        for (std::size_t n = 0; n < range_length && it != m.end(); ++n, ++it)
+            sum += it->second;
+    }
+    std::snprintf(name, sizeof(name), "map range scan of %zu (%s)", range_length, variant);
+    bench::report(name, range_scans * range_length, range_timer.seconds());
+
+    bench::timer erase_timer;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        m.erase(keys[i]);
+    std::snprintf(name, sizeof(name), "map erase             (%s)", variant);
+    bench::report(name, keys.size(), erase_timer.seconds());
+
+    bench::do_not_optimize(sum);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_unordered_map.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:41:52 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 10:41:52 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+#include <vector>
+
+#if __cplusplus >= 201103L
+# include <unordered_map>
+#else
+# include <tr1/unordered_map>
+#endif
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "unordered_map.hpp"
+
+// ft::unordered_map (open addressing) against ft::map and the standard library's node-based hash
+// map (std::tr1::unordered_map in C++98 builds): inserts, hits, misses and erases of random ints.
+
+namespace
+{
+#if __cplusplus >= 201103L
+    typedef std::unordered_map<int, int> std_hash_map;
+#else
+    typedef std::tr1::unordered_map<int, int> std_hash_map;
+#endif
+
+    const std::size_t element_count = 200000;
+
+    template <typename Map, typename Pair>
+    void run(const char *label, const std::vector<int> &keys, const std::vector<int> &missing)
+    {
+        char name[64];
+        Map m;
+
+        bench::timer insert_timer;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            m.insert(Pair(keys[i], static_cast<int>(i)));
+        std::snprintf(name, sizeof(name), "%-20s insert", label);
+        bench::report(name, keys.size(), insert_timer.seconds());
+
+        long found = 0;
+        bench::timer hit_timer;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            found += m.count(keys[i]);
+        std::snprintf(name, sizeof(name), "%-20s find hit", label);
+        bench::report(name, keys.size(), hit_timer.seconds());
+
+        bench::timer miss_timer;
+        for (std::size_t i = 0; i < missing.size(); ++i)
+            found += m.count(missing[i]);
+        std::snprintf(name, sizeof(name), "%-20s find miss", label);
+        bench::report(name, missing.size(), miss_timer.seconds());
+
+        bench::timer erase_timer;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            m.erase(keys[i]);
+        std::snprintf(name, sizeof(name), "%-20s erase", label);
+        bench::report(name, keys.size(), erase_timer.seconds());
+        bench::do_not_optimize(found);
+    }
+}
+
+int main()
+{
+    // Even keys are stored, odd keys are the misses
+    bench::rng rng;
+    std::vector<int> keys;
+    std::vector<int> missing;
+    for (std::size_t i = 0; i < element_count; ++i)
+    {
+        int k = static_cast<int>(rng.next() & 0x3fffffff);
+        keys.push_back(k & ~1);
+        missing.push_back(k | 1);
+    }
+
+    run<ft::unordered_map<int, int>, ft::pair<const int, int> >("ft::unordered_map", keys, missing);
+    run<ft::map<int, int>, ft::pair<const int, int> >("ft::map", keys, missing);
+    run<std_hash_map, std::pair<const int, int> >("std unordered_map", keys, missing);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,254 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   allocator_traits.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:56:13 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 08:56:13 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ALLOCATOR_TRAITS_HPP
+# define ALLOCATOR_TRAITS_HPP
+
+# include "type_trait.hpp"
+
+/**
+ * @brief The part of C++11 std::allocator_traits the containers need for stateful allocators
+ * (arenas, per-request pools), where two allocator objects are not interchangeable:
+ *
+ *  - select_on_container_copy_construction: the allocator a copy of a container uses, the
+ *    source's by default.
+ *  - propagate_on_container_copy_assignment / _swap: whether assigning / swapping containers
+ *    also assigns / swaps their allocators. false by default: each container keeps its own.
+ *  - is_always_equal: whether any two allocators of the type can free each other's memory, by
+ *    default when the type has no state.
+ *
+ * An allocator opts in by declaring the member as in C++11, with ft::true_type / ft::false_type
+ * (`typedef ft::true_type propagate_on_container_swap;`). There are no moves in C++98, so
+ * propagate_on_container_move_assignment is read but never used.
+ *
+ * Swapping two containers whose allocators do not propagate on swap and compare unequal is
+ * undefined, as in the standard.
+ *
+ * @link https://en.cppreference.com/w/cpp/memory/allocator_traits @endlink
+ * @link https://en.cppreference.com/w/cpp/memory/uses_allocator @endlink
+ */
+
+namespace ft
+{
+    // Defines allocator_has_<member>: true when Alloc declares the nested type
+# define FT_ALLOCATOR_HAS_TYPE(member)                                          \
+    template <typename Alloc>                                                   \
+    struct allocator_has_##member                                               \
+    {                                                                           \
+    private:                                                                    \
+        typedef char yes;                                                       \
+        typedef char (&no)[2];                                                  \
+                                                                                \
+        template <typename U>                                                   \
+        static yes test(typename U::member *);                                  \
+                                                                                \
+        template <typename U>                                                   \
+        static no test(...);                                                    \
+                                                                                \
+    public:                                                                     \
+        static const bool value = sizeof(test<Alloc>(0)) == sizeof(yes);        \
+    };
+
+    FT_ALLOCATOR_HAS_TYPE(propagate_on_container_copy_assignment)
+    FT_ALLOCATOR_HAS_TYPE(propagate_on_container_move_assignment)
+    FT_ALLOCATOR_HAS_TYPE(propagate_on_container_swap)
+    FT_ALLOCATOR_HAS_TYPE(is_always_equal)
+    FT_ALLOCATOR_HAS_TYPE(allocator_type)
+
+# undef FT_ALLOCATOR_HAS_TYPE
+
+    // True when Alloc has a member `Alloc select_on_container_copy_construction() const`
+    template <typename Alloc>
+    struct allocator_has_select_on_copy
+    {
+    private:
+        typedef char yes;
+        typedef char (&no)[2];
+
+        template <typename U, U>
+        struct check;
+
+        template <typename U>
+        static yes test(check<U (U::*)() const, &U::select_on_container_copy_construction> *);
+
+        template <typename U>
+        static no test(...);
+
+    public:
+        static const bool value = sizeof(test<Alloc>(0)) == sizeof(yes);
+    };
+
+    // True when Alloc has a member `bool deallocation_is_noop() const` (bulk-releasing arenas)
+    template <typename Alloc>
+    struct allocator_has_deallocation_is_noop
+    {
+    private:
+        typedef char yes;
+        typedef char (&no)[2];
+
+        template <typename U, U>
+        struct check;
+
+        template <typename U>
+        static yes test(check<bool (U::*)() const, &U::deallocation_is_noop> *);
+
+        template <typename U>
+        static no test(...);
+
+    public:
+        static const bool value = sizeof(test<Alloc>(0)) == sizeof(yes);
+    };
+
+    template <bool B>
+    struct allocator_bool_constant : public false_type
+    {
+    };
+
+    template <>
+    struct allocator_bool_constant<true> : public true_type
+    {
+    };
+
+    template <typename Alloc>
+    struct allocator_traits
+    {
+        typedef Alloc allocator_type;
+        typedef typename Alloc::value_type value_type;
+        typedef typename Alloc::pointer pointer;
+        typedef typename Alloc::const_pointer const_pointer;
+        typedef typename Alloc::size_type size_type;
+        typedef typename Alloc::difference_type difference_type;
+
+    private:
+        template <typename A, bool Declared>
+        struct pocca
+        {
+            typedef false_type type;
+        };
+
+        template <typename A>
+        struct pocca<A, true>
+        {
+            typedef typename A::propagate_on_container_copy_assignment type;
+        };
+
+        template <typename A, bool Declared>
+        struct pocma
+        {
+            typedef false_type type;
+        };
+
+        template <typename A>
+        struct pocma<A, true>
+        {
+            typedef typename A::propagate_on_container_move_assignment type;
+        };
+
+        template <typename A, bool Declared>
+        struct pocs
+        {
+            typedef false_type type;
+        };
+
+        template <typename A>
+        struct pocs<A, true>
+        {
+            typedef typename A::propagate_on_container_swap type;
+        };
+
+        template <typename A, bool Declared>
+        struct always_equal
+        {
+            typedef typename allocator_bool_constant<__is_empty(A)>::type type;
+        };
+
+        template <typename A>
+        struct always_equal<A, true>
+        {
+            typedef typename A::is_always_equal type;
+        };
+
+        template <typename A>
+        static A select(const A &alloc, true_type)
+        {
+            return alloc.select_on_container_copy_construction();
+        }
+
+        template <typename A>
+        static A select(const A &alloc, false_type)
+        {
+            return alloc;
+        }
+
+        template <typename A>
+        static bool noop_deallocation(const A &alloc, true_type)
+        {
+            return alloc.deallocation_is_noop();
+        }
+
+        template <typename A>
+        static bool noop_deallocation(const A &, false_type)
+        {
+            return false;
+        }
+
+    public:
+        typedef typename pocca<Alloc, allocator_has_propagate_on_container_copy_assignment<Alloc>::value>::type
+            propagate_on_container_copy_assignment;
+        typedef typename pocma<Alloc, allocator_has_propagate_on_container_move_assignment<Alloc>::value>::type
+            propagate_on_container_move_assignment;
+        typedef typename pocs<Alloc, allocator_has_propagate_on_container_swap<Alloc>::value>::type
+            propagate_on_container_swap;
+        typedef typename always_equal<Alloc, allocator_has_is_always_equal<Alloc>::value>::type
+            is_always_equal;
+
+        static Alloc select_on_container_copy_construction(const Alloc &alloc)
+        {
+            typedef typename allocator_bool_constant<allocator_has_select_on_copy<Alloc>::value>::type has_select;
+            return select(alloc, has_select());
+        }
+
+        /**
+         * Whether deallocate does nothing for this allocator object, its memory going back all at
+         * once (ft::pmr::monotonic_buffer_resource): containers may then drop elements that need
+         * no destructor without visiting them. Allocators declare `bool deallocation_is_noop() const`.
+         */
+        static bool deallocation_is_noop(const Alloc &alloc)
+        {
+            typedef typename allocator_bool_constant<allocator_has_deallocation_is_noop<Alloc>::value>::type has_query;
+            return noop_deallocation(alloc, has_query());
+        }
+
+        // Whether memory of one may be freed through the other
+        static bool equal(const Alloc &lhs, const Alloc &rhs)
+        {
+            return is_always_equal::value || lhs == rhs;
+        }
+    };
+
+    /**
+     * @brief True when T takes an allocator of type Alloc in its allocator-extended constructors
+     * (T(alloc), T(other, alloc)): T declares allocator_type and Alloc is that type.
+     */
+    template <typename T, typename Alloc, bool = allocator_has_allocator_type<T>::value>
+    struct uses_allocator : public false_type
+    {
+    };
+
+    template <typename T, typename Alloc>
+    struct uses_allocator<T, Alloc, true>
+        : public allocator_bool_constant<is_same<typename T::allocator_type, Alloc>::value>
+    {
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   atomic.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:02:11 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 09:02:11 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ATOMIC_HPP
+# define ATOMIC_HPP
+
+# include <cstddef>
+
+/**
+ * @brief C++98 has no <atomic>, so the concurrent containers go through these thin wrappers
+ * over the GCC/Clang __atomic builtins. Every load is acquire and every store is release
+ * unless the name says otherwise, which is what single-word publication needs.
+ *
+ * @link https://gcc.gnu.org/onlinedocs/gcc/_005f_005fatomic-Builtins.html @endlink
+ * @link https://preshing.com/20120913/acquire-and-release-semantics/ @endlink
+ */
+
+// Size of a cache line on the targets we care about, used to pad hot shared fields
+# define FT_CACHE_LINE_SIZE 64
+
+namespace ft
+{
+    template <typename T>
+    inline T atomic_load(const T *ptr)
+    {
+        return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+    }
+
+    template <typename T>
+    inline T atomic_load_relaxed(const T *ptr)
+    {
+        return __atomic_load_n(ptr, __ATOMIC_RELAXED);
+    }
+
+    template <typename T>
+    inline void atomic_store(T *ptr, T value)
+    {
+        __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+    }
+
+    template <typename T>
+    inline void atomic_store_relaxed(T *ptr, T value)
+    {
+        __atomic_store_n(ptr, value, __ATOMIC_RELAXED);
+    }
+
+    template <typename T>
+    inline T atomic_exchange(T *ptr, T value)
+    {
+        return __atomic_exchange_n(ptr, value, __ATOMIC_ACQ_REL);
+    }
+
+    template <typename T>
+    inline T atomic_fetch_add(T *ptr, T value)
+    {
+        return __atomic_fetch_add(ptr, value, __ATOMIC_ACQ_REL);
+    }
+
+    // For counters that order nothing, only their own total
+    template <typename T>
+    inline T atomic_fetch_add_relaxed(T *ptr, T value)
+    {
+        return __atomic_fetch_add(ptr, value, __ATOMIC_RELAXED);
+    }
+
+    template <typename T>
+    inline T atomic_fetch_sub(T *ptr, T value)
+    {
+        return __atomic_fetch_sub(ptr, value, __ATOMIC_ACQ_REL);
+    }
+
+    // On failure `expected` is refreshed with the current value, like std::atomic
+    template <typename T>
+    inline bool atomic_compare_exchange(T *ptr, T &expected, T desired)
+    {
+        return __atomic_compare_exchange_n(ptr, &expected, desired, false,
+                                           __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    }
+
+    // Sequentially consistent CAS, for algorithms proven with one (Chase-Lev deque)
+    template <typename T>
+    inline bool atomic_compare_exchange_seq_cst(T *ptr, T &expected, T desired)
+    {
+        return __atomic_compare_exchange_n(ptr, &expected, desired, false,
+                                           __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+    }
+
+    // Full barrier, needed where a store must be visible before a following load
+    inline void atomic_thread_fence()
+    {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+
+    // Hint to the CPU that we are spinning
+    inline void cpu_relax()
+    {
+# if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+# endif
+    }
+} // namespace ft
+
+#endif
\ No newline at end of file
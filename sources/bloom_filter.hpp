@@ -0,0 +1,272 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bloom_filter.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:41:07 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 10:41:07 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BLOOM_FILTER_HPP
+# define BLOOM_FILTER_HPP
+
+# include <algorithm>
+# include <cstddef>
+
+# include "atomic.hpp"
+# include "hash.hpp"
+# include "vector.hpp"
+
+/**
+ * @brief Negative-lookup filters for ft::map (map::enable_bloom_filter). A filter answers "surely
+ * absent" or "maybe present" for a key; the map only descends the tree on "maybe", so misses cost
+ * one cache line instead of a root-to-leaf walk.
+ *
+ * counting_bloom_filter is a blocked counting Bloom filter: each key maps to one 64 byte block
+ * (aligned, so one cache line) and sets k of its 128 4-bit counters. Counters let erase take a key
+ * back out; a counter that reaches 15 saturates and is never decremented again, so the filter can
+ * only err towards "maybe". The false-positive rate with c counters per key and k = c ln 2 probes
+ * is about 0.6185^c, a bit more for the blocking: roughly 2% at the default 8 counters (4 bytes)
+ * per key.
+ *
+ * key_filter is the interface the map holds, so that hashing the key type is only required from
+ * maps that enable a filter. Lookups only read the counters and bump the stats with relaxed
+ * atomic adds, so const lookups of one map may run on several threads, as with std::map.
+ *
+ * @link https://en.wikipedia.org/wiki/Bloom_filter#Counting_Bloom_filters @endlink
+ * @link https://algo2.iti.kit.edu/singler/publications/cacheefficientbloomfilters-wea2007.pdf @endlink
+ */
+
+namespace ft
+{
+    struct bloom_filter_stats
+    {
+        std::size_t lookups;         // Lookups of the map while the filter is on
+        std::size_t rejected;        // Answered "absent" by the filter alone
+        std::size_t false_positives; // Passed the filter, then missed in the tree
+        std::size_t rebuilds;        // Resizes as the map outgrew the filter
+        std::size_t memory;          // Bytes of counters
+
+        bloom_filter_stats()
+            : lookups(0), rejected(0), false_positives(0), rebuilds(0), memory(0)
+        {
+        }
+
+        // Share of the lookups for absent keys that the filter let through
+        double false_positive_rate() const
+        {
+            std::size_t absent = rejected + false_positives;
+            return absent == 0 ? 0.0 : static_cast<double>(false_positives) / static_cast<double>(absent);
+        }
+    };
+
+    template <typename Key>
+    class key_filter
+    {
+    public:
+        virtual ~key_filter()
+        {
+        }
+
+        virtual void add(const Key &key) = 0;
+        virtual void remove(const Key &key) = 0;
+        virtual bool may_contain(const Key &key) const = 0;
+
+        // Empties the filter, keeping its size
+        virtual void clear() = 0;
+
+        // Empties the filter and sizes it for keys elements
+        virtual void reset(std::size_t keys) = 0;
+
+        // Elements the filter was sized for
+        virtual std::size_t capacity() const = 0;
+        virtual std::size_t memory() const = 0;
+        virtual key_filter *clone() const = 0;
+
+    public:
+        // may_contain, counted in the stats
+        bool query(const Key &key) const
+        {
+            atomic_fetch_add_relaxed(&stats_.lookups, std::size_t(1));
+            if (may_contain(key))
+                return true;
+            atomic_fetch_add_relaxed(&stats_.rejected, std::size_t(1));
+            return false;
+        }
+
+        void record_false_positive() const
+        {
+            atomic_fetch_add_relaxed(&stats_.false_positives, std::size_t(1));
+        }
+
+        void record_rebuild()
+        {
+            ++stats_.rebuilds;
+        }
+
+        // Each counter is read on its own, so a snapshot taken during lookups may be skewed by a few
+        bloom_filter_stats stats() const
+        {
+            bloom_filter_stats result;
+            result.lookups = atomic_load_relaxed(&stats_.lookups);
+            result.rejected = atomic_load_relaxed(&stats_.rejected);
+            result.false_positives = atomic_load_relaxed(&stats_.false_positives);
+            result.rebuilds = stats_.rebuilds;
+            result.memory = memory();
+            return result;
+        }
+
+        void reset_stats()
+        {
+            stats_ = bloom_filter_stats();
+        }
+
+    protected:
+        mutable bloom_filter_stats stats_;
+    };
+
+    template <typename Key, typename Hash = hash<Key> >
+    class counting_bloom_filter : public key_filter<Key>
+    {
+    public:
+        typedef Key key_type;
+        typedef Hash hasher;
+
+    private:
+        typedef unsigned long long word_type;
+
+        static const std::size_t block_words = 8;   // 64 bytes
+        static const std::size_t word_counters = 16; // 4 bits each
+        static const std::size_t block_counters = block_words * word_counters;
+        static const std::size_t max_probes = 8;     // 7 bits of the probe hash each
+        static const word_type saturated = 15;
+
+    public:
+        explicit counting_bloom_filter(std::size_t counters_per_key = 8, std::size_t keys = 0,
+                                       const hasher &hash = hasher())
+            : hash_(hash), counters_per_key_(std::max(counters_per_key, std::size_t(1))),
+              probes_(0), capacity_(0), mask_(0), storage_(), blocks_(NULL)
+        {
+            // k = c ln 2 minimizes the false-positive rate
+            probes_ = std::min(std::max((counters_per_key_ * 693 + 500) / 1000, std::size_t(1)), std::size_t(max_probes));
+            reset(keys);
+        }
+
+        counting_bloom_filter(const counting_bloom_filter &other)
+            : key_filter<Key>(other), hash_(other.hash_), counters_per_key_(other.counters_per_key_),
+              probes_(other.probes_), capacity_(other.capacity_), mask_(other.mask_),
+              storage_(other.storage_.size()), blocks_(align(storage_.data()))
+        {
+            std::copy(other.blocks_, other.blocks_ + (mask_ + 1) * block_words, blocks_);
+        }
+
+    private:
+        counting_bloom_filter &operator=(const counting_bloom_filter &);
+
+    public:
+        void add(const key_type &key)
+        {
+            std::size_t h = hash_(key);
+            word_type *block = block_of(h);
+            std::size_t bits = hash_mix(h);
+            for (std::size_t i = 0; i < probes_; ++i, bits >>= 7)
+            {
+                word_type &word = block[(bits & (block_counters - 1)) / word_counters];
+                const std::size_t shift = (bits % word_counters) * 4;
+                if (((word >> shift) & saturated) != saturated)
+                    word += word_type(1) << shift;
+            }
+        }
+
+        void remove(const key_type &key)
+        {
+            std::size_t h = hash_(key);
+            word_type *block = block_of(h);
+            std::size_t bits = hash_mix(h);
+            for (std::size_t i = 0; i < probes_; ++i, bits >>= 7)
+            {
+                word_type &word = block[(bits & (block_counters - 1)) / word_counters];
+                const std::size_t shift = (bits % word_counters) * 4;
+                const word_type counter = (word >> shift) & saturated;
+                if (counter != saturated && counter != 0)
+                    word -= word_type(1) << shift;
+            }
+        }
+
+        bool may_contain(const key_type &key) const
+        {
+            std::size_t h = hash_(key);
+            const word_type *block = block_of(h);
+            std::size_t bits = hash_mix(h);
+            for (std::size_t i = 0; i < probes_; ++i, bits >>= 7)
+            {
+                const word_type word = block[(bits & (block_counters - 1)) / word_counters];
+                if (((word >> ((bits % word_counters) * 4)) & saturated) == 0)
+                    return false;
+            }
+            return true;
+        }
+
+        void clear()
+        {
+            std::fill(blocks_, blocks_ + (mask_ + 1) * block_words, word_type(0));
+        }
+
+        // Rounds the block count up to a power of two, for at least 1024 keys
+        void reset(std::size_t keys)
+        {
+            keys = std::max(keys, std::size_t(1024));
+            std::size_t blocks = 1;
+            while (blocks * block_counters < keys * counters_per_key_)
+                blocks <<= 1;
+
+            vector<word_type> storage(blocks * block_words + block_words - 1, word_type(0));
+            storage_.swap(storage);
+            blocks_ = align(storage_.data());
+            mask_ = blocks - 1;
+            capacity_ = blocks * block_counters / counters_per_key_;
+        }
+
+        std::size_t capacity() const
+        {
+            return capacity_;
+        }
+
+        std::size_t memory() const
+        {
+            return (mask_ + 1) * block_words * sizeof(word_type);
+        }
+
+        key_filter<Key> *clone() const
+        {
+            return new counting_bloom_filter(*this);
+        }
+
+    private:
+        static word_type *align(word_type *ptr)
+        {
+            const std::size_t line = block_words * sizeof(word_type);
+            const std::size_t address = reinterpret_cast<std::size_t>(ptr);
+            return ptr + ((line - address % line) % line) / sizeof(word_type);
+        }
+
+        word_type *block_of(std::size_t h) const
+        {
+            return blocks_ + (h & mask_) * block_words;
+        }
+
+    private:
+        hasher hash_;
+        std::size_t counters_per_key_;
+        std::size_t probes_;
+        std::size_t capacity_;
+        std::size_t mask_;
+        vector<word_type> storage_;
+        word_type *blocks_;
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,807 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_map.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:24:35 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 09:24:35 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_MAP_HPP
+# define CONCURRENT_MAP_HPP
+
+# include <cstddef>
+# include <functional>
+# include <iterator>
+# include <memory>
+
+# include "atomic.hpp"
+# include "mutex.hpp"
+# include "utility.hpp"
+# include "vector.hpp"
+
+/**
+ * @brief Read-mostly map where readers never take a lock. The map is a persistent AVL tree: a
+ * published node is never changed again, readers pin the current root and search it directly. The
+ * writer stages updates and applies a batch by copying only the root-to-leaf paths it touches, the
+ * new root shares every untouched subtree with the old one and is published with one atomic
+ * pointer store (RCU).
+ *
+ * The nodes a batch replaced are freed with epoch-based reclamation: every reader announces the
+ * global epoch it started in, every replaced node remembers the epoch it was retired in, and it is
+ * only freed once no reader announced an older epoch. When all MaxReaders slots are taken, extra
+ * readers are only counted, and nothing is freed while any of them is inside.
+ *
+ * Batching still pays: updates close to each other share the copied top of the tree, a node
+ * copied once in a batch is changed in place by the rest of that batch.
+ *
+ * @link https://en.wikipedia.org/wiki/Read-copy-update @endlink
+ * @link https://en.wikipedia.org/wiki/Persistent_data_structure#Path_copying @endlink
+ * @link https://www.cl.cam.ac.uk/techreports/UCAM-CL-TR-579.pdf @endlink
+ */
+
+namespace ft
+{
+    template <typename Key, typename T, typename Compare = std::less<Key>,
+              typename Allocator = std::allocator<pair<const Key, T> >,
+              std::size_t MaxReaders = 64>
+    class concurrent_map
+    {
+    public:
+        typedef Key                 key_type;
+        typedef T                   mapped_type;
+        typedef pair<const Key, T>  value_type;
+        typedef Compare             key_compare;
+        typedef Allocator           allocator_type;
+        typedef std::size_t         size_type;
+
+    private:
+        enum op_kind
+        {
+            op_insert,
+            op_assign,
+            op_erase
+        };
+
+        struct pending_op
+        {
+            op_kind kind;
+            pair<key_type, mapped_type> value;
+
+            pending_op(op_kind k, const key_type &key, const mapped_type &mapped)
+                : kind(k), value(key, mapped)
+            {
+            }
+        };
+
+        // Immutable once published, only the batch that created it may still change it
+        struct node
+        {
+            value_type value;
+            node *left;
+            node *right;
+            size_type size;      // Nodes in this subtree
+            int height;          // AVL height, a leaf is 1
+            unsigned long batch; // Writer batch that created the node
+        };
+
+        typedef typename allocator_type::template rebind<node>::other node_allocator;
+
+        struct retired_node
+        {
+            node *ptr;
+            unsigned long epoch;
+
+            retired_node(node *n, unsigned long e)
+                : ptr(n), epoch(e)
+            {
+            }
+        };
+
+        // One per concurrent reader, 0 means the slot is free
+        struct reader_slot
+        {
+            unsigned long epoch;
+            char pad[FT_CACHE_LINE_SIZE - sizeof(unsigned long)];
+
+            reader_slot() : epoch(0)
+            {
+            }
+        };
+
+    public:
+        /**
+         * @brief In-order iterator over one pinned version. Nodes have no parent links (a node is
+         * shared by several versions), so stepping to the next node without a right child
+         * searches it again from the root.
+         */
+        class const_iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef typename concurrent_map::value_type value_type;
+            typedef const value_type &              reference;
+            typedef const value_type *              pointer;
+            typedef std::ptrdiff_t                  difference_type;
+
+        public:
+            const_iterator()
+                : root_(NULL), node_(NULL), comp_(NULL)
+            {
+            }
+
+            const_iterator(const node *root, const node *n, const key_compare *comp)
+                : root_(root), node_(n), comp_(comp)
+            {
+            }
+
+        public:
+            reference operator*() const
+            {
+                return node_->value;
+            }
+
+            pointer operator->() const
+            {
+                return &node_->value;
+            }
+
+            const_iterator &operator++()
+            {
+                node_ = concurrent_map::next(root_, node_, *comp_);
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                const_iterator tmp(*this);
+                ++*this;
+                return tmp;
+            }
+
+            const_iterator &operator--()
+            {
+                node_ = concurrent_map::prev(root_, node_, *comp_);
+                return *this;
+            }
+
+            const_iterator operator--(int)
+            {
+                const_iterator tmp(*this);
+                --*this;
+                return tmp;
+            }
+
+            bool operator==(const const_iterator &rhs) const
+            {
+                return node_ == rhs.node_;
+            }
+
+            bool operator!=(const const_iterator &rhs) const
+            {
+                return node_ != rhs.node_;
+            }
+
+        private:
+            const node *root_;
+            const node *node_; // NULL is end()
+            const key_compare *comp_;
+        };
+
+        /**
+         * @brief Pins the currently published version for as long as it lives. Everything read
+         * through it is consistent, even while the writer publishes newer versions.
+         */
+        class snapshot
+        {
+        public:
+            explicit snapshot(const concurrent_map &owner)
+                : owner_(owner),
+                  slot_(owner.enter()),
+                  root_(atomic_load(&owner.root_))
+            {
+            }
+
+            ~snapshot()
+            {
+                owner_.leave(slot_);
+            }
+
+        public:
+            const_iterator find(const key_type &key) const
+            {
+                const node *n = lower(key);
+                if (n != NULL && owner_.comp_(key, n->value.first))
+                    n = NULL;
+                return make_iterator(n);
+            }
+
+            size_type count(const key_type &key) const
+            {
+                return find(key) == end() ? 0 : 1;
+            }
+
+            const_iterator lower_bound(const key_type &key) const
+            {
+                return make_iterator(lower(key));
+            }
+
+            const_iterator upper_bound(const key_type &key) const
+            {
+                const node *result = NULL;
+                for (const node *n = root_; n != NULL;)
+                {
+                    if (owner_.comp_(key, n->value.first))
+                    {
+                        result = n;
+                        n = n->left;
+                    }
+                    else
+                        n = n->right;
+                }
+                return make_iterator(result);
+            }
+
+            const_iterator begin() const
+            {
+                const node *n = root_;
+                while (n != NULL && n->left != NULL)
+                    n = n->left;
+                return make_iterator(n);
+            }
+
+            const_iterator end() const
+            {
+                return make_iterator(NULL);
+            }
+
+            size_type size() const
+            {
+                return root_ == NULL ? 0 : root_->size;
+            }
+
+        private:
+            snapshot(const snapshot &);
+            snapshot &operator=(const snapshot &);
+
+            // First node whose key is not less than key
+            const node *lower(const key_type &key) const
+            {
+                const node *result = NULL;
+                for (const node *n = root_; n != NULL;)
+                {
+                    if (!owner_.comp_(n->value.first, key))
+                    {
+                        result = n;
+                        n = n->left;
+                    }
+                    else
+                        n = n->right;
+                }
+                return result;
+            }
+
+            const_iterator make_iterator(const node *n) const
+            {
+                return const_iterator(root_, n, &owner_.comp_);
+            }
+
+        private:
+            const concurrent_map &owner_;
+            std::size_t slot_;
+            const node *root_;
+        };
+
+        friend class const_iterator;
+        friend class snapshot;
+
+    public:
+        explicit concurrent_map(size_type batch_size = 1024, const key_compare &comp = key_compare(),
+                                const allocator_type &alloc = allocator_type())
+            : root_(NULL),
+              batch_size_(batch_size == 0 ? 1 : batch_size),
+              epoch_(1),
+              overflow_readers_(0),
+              comp_(comp),
+              alloc_(node_allocator(alloc)),
+              value_alloc_(alloc),
+              batch_(1)
+        {
+        }
+
+        ~concurrent_map()
+        {
+            for (size_type i = 0; i < retired_.size(); ++i)
+                delete_node(retired_[i].ptr);
+            destroy(root_);
+        }
+
+    // Readers, lock-free
+    public:
+        bool find(const key_type &key, mapped_type &out) const
+        {
+            snapshot snap(*this);
+            const_iterator it = snap.find(key);
+            if (it == snap.end())
+                return false;
+            out = it->second;
+            return true;
+        }
+
+        size_type count(const key_type &key) const
+        {
+            snapshot snap(*this);
+            return snap.count(key);
+        }
+
+        size_type size() const
+        {
+            snapshot snap(*this);
+            return snap.size();
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+    // Writer, serialized by writer_lock_
+    public:
+        // Staged, visible to readers after the next publish()
+        void insert(const value_type &value)
+        {
+            stage(pending_op(op_insert, value.first, value.second));
+        }
+
+        void assign(const key_type &key, const mapped_type &value)
+        {
+            stage(pending_op(op_assign, key, value));
+        }
+
+        void erase(const key_type &key)
+        {
+            stage(pending_op(op_erase, key, mapped_type()));
+        }
+
+        // Applies every staged update on copies of the paths it touches and publishes the new root
+        void publish()
+        {
+            lock_guard<mutex> guard(writer_lock_);
+            publish_locked();
+        }
+
+        // Frees the retired nodes no reader can see anymore
+        void reclaim()
+        {
+            lock_guard<mutex> guard(writer_lock_);
+            reclaim_locked();
+        }
+
+        size_type pending() const
+        {
+            lock_guard<mutex> guard(writer_lock_);
+            return pending_.size();
+        }
+
+        // Replaced nodes still waiting for older readers to leave
+        size_type retired() const
+        {
+            lock_guard<mutex> guard(writer_lock_);
+            return retired_.size();
+        }
+
+        key_compare key_comp() const
+        {
+            return comp_;
+        }
+
+    private:
+        concurrent_map(const concurrent_map &);
+        concurrent_map &operator=(const concurrent_map &);
+
+        void stage(const pending_op &op)
+        {
+            lock_guard<mutex> guard(writer_lock_);
+            pending_.push_back(op);
+            if (pending_.size() >= batch_size_)
+                publish_locked();
+        }
+
+        void publish_locked()
+        {
+            if (pending_.empty())
+                return;
+
+            node *root = root_;
+            try
+            {
+                for (size_type i = 0; i < pending_.size(); ++i)
+                {
+                    bool changed = false;
+                    if (pending_[i].kind == op_erase)
+                        root = erase_node(root, pending_[i].value.first, changed);
+                    else
+                        root = insert_node(root, pending_[i], changed);
+                }
+                retired_.reserve(retired_.size() + replaced_.size());
+            }
+            catch (...)
+            {
+                // The published tree was never touched, only this batch's nodes are dropped
+                for (size_type i = 0; i < created_.size(); ++i)
+                    delete_node(created_[i]);
+                created_.clear();
+                dropped_.clear();
+                replaced_.clear();
+                throw;
+            }
+            pending_.clear();
+
+            atomic_store(&root_, root);
+            unsigned long retire_epoch = atomic_fetch_add(&epoch_, 1UL) + 1;
+            for (size_type i = 0; i < replaced_.size(); ++i)
+                retired_.push_back(retired_node(replaced_[i], retire_epoch));
+            // Created and dropped by the same batch, no reader ever saw them
+            for (size_type i = 0; i < dropped_.size(); ++i)
+                delete_node(dropped_[i]);
+            replaced_.clear();
+            created_.clear();
+            dropped_.clear();
+            ++batch_;
+            reclaim_locked();
+        }
+
+        void reclaim_locked()
+        {
+            // Pairs with the fence in enter(): either the reader's announcement is seen here,
+            // or the reader is guaranteed to load the root published before this fence
+            atomic_thread_fence();
+            if (atomic_load(&overflow_readers_) != 0)
+                return;
+            unsigned long oldest = atomic_load(&epoch_);
+            for (std::size_t i = 0; i < MaxReaders; ++i)
+            {
+                unsigned long e = atomic_load(&slots_[i].epoch);
+                if (e != 0 && e < oldest)
+                    oldest = e;
+            }
+
+            size_type kept = 0;
+            for (size_type i = 0; i < retired_.size(); ++i)
+            {
+                if (retired_[i].epoch <= oldest)
+                    delete_node(retired_[i].ptr);
+                else
+                    retired_[kept++] = retired_[i];
+            }
+            while (retired_.size() > kept)
+                retired_.pop_back();
+        }
+
+    // Path copying, writer only
+    private:
+        node *insert_node(node *n, const pending_op &op, bool &changed)
+        {
+            if (n == NULL)
+            {
+                changed = true;
+                return create_node(value_type(op.value.first, op.value.second));
+            }
+            if (comp_(op.value.first, n->value.first))
+            {
+                node *child = insert_node(n->left, op, changed);
+                if (!changed)
+                    return n;
+                n = writable(n);
+                n->left = child;
+                return rebalance(n);
+            }
+            if (comp_(n->value.first, op.value.first))
+            {
+                node *child = insert_node(n->right, op, changed);
+                if (!changed)
+                    return n;
+                n = writable(n);
+                n->right = child;
+                return rebalance(n);
+            }
+            if (op.kind == op_insert)
+                return n;
+            changed = true;
+            n = writable(n);
+            n->value.second = op.value.second;
+            return n;
+        }
+
+        node *erase_node(node *n, const key_type &key, bool &changed)
+        {
+            if (n == NULL)
+                return NULL;
+            if (comp_(key, n->value.first))
+            {
+                node *child = erase_node(n->left, key, changed);
+                if (!changed)
+                    return n;
+                n = writable(n);
+                n->left = child;
+                return rebalance(n);
+            }
+            if (comp_(n->value.first, key))
+            {
+                node *child = erase_node(n->right, key, changed);
+                if (!changed)
+                    return n;
+                n = writable(n);
+                n->right = child;
+                return rebalance(n);
+            }
+            changed = true;
+            if (n->left == NULL || n->right == NULL)
+            {
+                node *child = n->left != NULL ? n->left : n->right;
+                drop(n);
+                return child;
+            }
+            // The in-order successor takes the erased node's place
+            node *successor = NULL;
+            node *right = detach_min(n->right, successor);
+            successor = writable(successor);
+            successor->left = n->left;
+            successor->right = right;
+            drop(n);
+            return rebalance(successor);
+        }
+
+        node *detach_min(node *n, node *&min)
+        {
+            if (n->left == NULL)
+            {
+                min = n;
+                return n->right;
+            }
+            node *child = detach_min(n->left, min);
+            n = writable(n);
+            n->left = child;
+            return rebalance(n);
+        }
+
+        // n itself if this batch created it, otherwise a copy, and n is retired
+        node *writable(node *n)
+        {
+            if (n->batch == batch_)
+                return n;
+            node *copy = create_node(n->value);
+            copy->left = n->left;
+            copy->right = n->right;
+            copy->size = n->size;
+            copy->height = n->height;
+            replaced_.push_back(n);
+            return copy;
+        }
+
+        // Unlinks n from the new version
+        void drop(node *n)
+        {
+            if (n->batch == batch_)
+                dropped_.push_back(n);
+            else
+                replaced_.push_back(n);
+        }
+
+        // n is writable, its subtrees are balanced and differ in height by at most 2
+        node *rebalance(node *n)
+        {
+            int diff = height(n->left) - height(n->right);
+            if (diff > 1)
+            {
+                if (height(n->left->left) < height(n->left->right))
+                    n->left = rotate_left(writable(n->left));
+                return rotate_right(n);
+            }
+            if (diff < -1)
+            {
+                if (height(n->right->right) < height(n->right->left))
+                    n->right = rotate_right(writable(n->right));
+                return rotate_left(n);
+            }
+            update(n);
+            return n;
+        }
+
+        node *rotate_left(node *n)
+        {
+            node *r = writable(n->right);
+            n->right = r->left;
+            update(n);
+            r->left = n;
+            update(r);
+            return r;
+        }
+
+        node *rotate_right(node *n)
+        {
+            node *l = writable(n->left);
+            n->left = l->right;
+            update(n);
+            l->right = n;
+            update(l);
+            return l;
+        }
+
+        static int height(const node *n)
+        {
+            return n == NULL ? 0 : n->height;
+        }
+
+        static size_type subtree_size(const node *n)
+        {
+            return n == NULL ? 0 : n->size;
+        }
+
+        static void update(node *n)
+        {
+            int hl = height(n->left);
+            int hr = height(n->right);
+            n->height = 1 + (hl > hr ? hl : hr);
+            n->size = 1 + subtree_size(n->left) + subtree_size(n->right);
+        }
+
+        // In-order neighbours of n in the tree under root, searched from the root
+        static const node *next(const node *root, const node *n, const key_compare &comp)
+        {
+            if (n->right != NULL)
+            {
+                n = n->right;
+                while (n->left != NULL)
+                    n = n->left;
+                return n;
+            }
+            const node *result = NULL;
+            while (root != n)
+            {
+                if (comp(n->value.first, root->value.first))
+                {
+                    result = root;
+                    root = root->left;
+                }
+                else
+                    root = root->right;
+            }
+            return result;
+        }
+
+        static const node *prev(const node *root, const node *n, const key_compare &comp)
+        {
+            if (n == NULL)
+            {
+                n = root;
+                while (n->right != NULL)
+                    n = n->right;
+                return n;
+            }
+            if (n->left != NULL)
+            {
+                n = n->left;
+                while (n->right != NULL)
+                    n = n->right;
+                return n;
+            }
+            const node *result = NULL;
+            while (root != n)
+            {
+                if (comp(root->value.first, n->value.first))
+                {
+                    result = root;
+                    root = root->right;
+                }
+                else
+                    root = root->left;
+            }
+            return result;
+        }
+
+    // Nodes
+    private:
+        node *create_node(const value_type &value)
+        {
+            node *n = alloc_.allocate(1);
+            try
+            {
+                value_alloc_.construct(&n->value, value);
+            }
+            catch (...)
+            {
+                alloc_.deallocate(n, 1);
+                throw;
+            }
+            n->left = NULL;
+            n->right = NULL;
+            n->size = 1;
+            n->height = 1;
+            n->batch = batch_;
+            try
+            {
+                created_.push_back(n);
+            }
+            catch (...)
+            {
+                delete_node(n);
+                throw;
+            }
+            return n;
+        }
+
+        void delete_node(node *n)
+        {
+            value_alloc_.destroy(&n->value);
+            alloc_.deallocate(n, 1);
+        }
+
+        void destroy(node *n)
+        {
+            if (n == NULL)
+                return;
+            destroy(n->left);
+            destroy(n->right);
+            delete_node(n);
+        }
+
+    // Reader slots
+    private:
+        // Claims a reader slot and announces the current epoch in it
+        std::size_t enter() const
+        {
+            // Threads run on different stacks, so a stack address spreads them over the slots
+            int probe;
+            std::size_t i = (reinterpret_cast<std::size_t>(&probe) >> 12) % MaxReaders;
+            for (std::size_t tries = 0; tries < MaxReaders; ++tries)
+            {
+                unsigned long e = atomic_load(&epoch_);
+                unsigned long expected = 0;
+                if (atomic_compare_exchange(&slots_[i].epoch, expected, e))
+                {
+                    atomic_thread_fence();
+                    return i;
+                }
+                i = (i + 1) % MaxReaders;
+            }
+            // Every slot is taken: the reader is only counted, and blocks all reclamation instead
+            atomic_fetch_add(&overflow_readers_, 1UL);
+            atomic_thread_fence();
+            return MaxReaders;
+        }
+
+        void leave(std::size_t slot) const
+        {
+            if (slot == MaxReaders)
+                atomic_fetch_sub(&overflow_readers_, 1UL);
+            else
+                atomic_store(&slots_[slot].epoch, 0UL);
+        }
+
+    private:
+        node *root_;
+        size_type batch_size_;
+        char pad0_[FT_CACHE_LINE_SIZE];
+        unsigned long epoch_;
+        char pad1_[FT_CACHE_LINE_SIZE];
+        mutable reader_slot slots_[MaxReaders];
+        mutable unsigned long overflow_readers_;
+        char pad2_[FT_CACHE_LINE_SIZE];
+        key_compare comp_;
+        node_allocator alloc_;
+        allocator_type value_alloc_;
+        mutable mutex writer_lock_;
+        unsigned long batch_;       // Current writer batch, nodes it created may be changed in place
+        vector<pending_op> pending_;
+        vector<node *> created_;    // Nodes created by the current batch
+        vector<node *> dropped_;    // Nodes created and unlinked by the current batch
+        vector<node *> replaced_;   // Published nodes the current batch copied or unlinked
+        vector<retired_node> retired_;
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,318 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:03:27 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 10:03:27 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_STACK_HPP
+# define CONCURRENT_STACK_HPP
+
+# include <cstddef>
+# include <memory>
+# include <stdexcept>
+
+# include "atomic.hpp"
+# include "mutex.hpp"
+
+/**
+ * @brief Lock-free LIFO stack (Treiber stack) for free lists and work lists shared between threads.
+ * push and try_pop are one compare-and-swap on the head each; push_batch links a whole range with
+ * one CAS and pop_all detaches the whole stack with one.
+ *
+ * Nodes are addressed by 32-bit index, and the head word holds the index of the top node next to
+ * a 32-bit tag bumped on every change, so a head that was popped and pushed back in between (ABA)
+ * still fails the CAS. Nodes come from chunks that double in size and are only freed with the
+ * stack; popped nodes go to a free list that is itself a tagged Treiber stack. After warm-up a
+ * push does not allocate at all.
+ *
+ * Everything but the destructor may be called from any number of threads at once.
+ *
+ * @link https://en.wikipedia.org/wiki/Treiber_stack @endlink
+ * @link https://en.wikipedia.org/wiki/ABA_problem @endlink
+ */
+
+namespace ft
+{
+    template <typename T, typename Allocator = std::allocator<T> >
+    class concurrent_stack
+    {
+    public:
+        typedef T               value_type;
+        typedef Allocator       allocator_type;
+        typedef std::size_t     size_type;
+
+    private:
+        typedef unsigned int        index_type; // 0 is the empty list
+        typedef unsigned long long  word_type;  // tag << 32 | index
+
+        struct node
+        {
+            T value;
+            index_type next;
+        };
+
+        typedef typename allocator_type::template rebind<node>::other node_allocator;
+
+        // Head words are CAS targets of every thread, one cache line each
+        struct padded_word
+        {
+            word_type word;
+            char pad[FT_CACHE_LINE_SIZE - sizeof(word_type)];
+
+            padded_word() : word(0)
+            {
+            }
+        };
+
+        // Chunk k holds first_chunk << k nodes, so 26 chunks cover every 32-bit index
+        enum { first_chunk_shift = 6, first_chunk = 1 << first_chunk_shift, max_chunks = 26 };
+
+    public:
+        explicit concurrent_stack(const allocator_type &alloc = allocator_type())
+            : value_alloc_(alloc), node_alloc_(alloc), chunk_count_(0)
+        {
+            for (size_type k = 0; k < max_chunks; ++k)
+                chunks_[k] = NULL;
+        }
+
+        // Not thread-safe: no other thread may use the stack any more
+        ~concurrent_stack()
+        {
+            for (index_type i = index_of(head_.word); i != 0; i = node_at(i)->next)
+                value_alloc_.destroy(&node_at(i)->value);
+            for (size_type k = 0; k < chunk_count_; ++k)
+                node_alloc_.deallocate(chunks_[k], size_type(first_chunk) << k);
+        }
+
+    public:
+        void push(const value_type &value)
+        {
+            const index_type i = acquire_node();
+            try
+            {
+                value_alloc_.construct(&node_at(i)->value, value);
+            }
+            catch (...)
+            {
+                push_chain(&free_.word, i, i);
+                throw;
+            }
+            push_chain(&head_.word, i, i);
+        }
+
+        // Pushes every element of the range as if one by one (*--last ends on top), in one CAS
+        template <typename InputIt>
+        void push_batch(InputIt first, InputIt last)
+        {
+            index_type top = 0;
+            index_type bottom = 0;
+            try
+            {
+                for (; first != last; ++first)
+                {
+                    const index_type i = acquire_node();
+                    try
+                    {
+                        value_alloc_.construct(&node_at(i)->value, *first);
+                    }
+                    catch (...)
+                    {
+                        push_chain(&free_.word, i, i);
+                        throw;
+                    }
+                    atomic_store_relaxed(&node_at(i)->next, top);
+                    if (bottom == 0)
+                        bottom = i;
+                    top = i;
+                }
+            }
+            catch (...)
+            {
+                if (top != 0)
+                {
+                    for (index_type i = top; i != 0; i = atomic_load_relaxed(&node_at(i)->next))
+                        value_alloc_.destroy(&node_at(i)->value);
+                    push_chain(&free_.word, top, bottom);
+                }
+                throw;
+            }
+            if (top != 0)
+                push_chain(&head_.word, top, bottom);
+        }
+
+        // Moves the top element into out; false when the stack is empty
+        bool try_pop(value_type &out)
+        {
+            const index_type i = pop_node(&head_.word);
+            if (i == 0)
+                return false;
+            node *n = node_at(i);
+            try
+            {
+                out = n->value;
+            }
+            catch (...)
+            {
+                push_chain(&head_.word, i, i);
+                throw;
+            }
+            value_alloc_.destroy(&n->value);
+            push_chain(&free_.word, i, i);
+            return true;
+        }
+
+        /**
+         * @brief Detaches the whole stack with one CAS and writes its elements to out, top first.
+         * If a copy throws, the elements not yet written go back on the stack.
+         */
+        template <typename OutputIt>
+        size_type pop_all(OutputIt out)
+        {
+            word_type old = atomic_load(&head_.word);
+            while (index_of(old) != 0 && !atomic_compare_exchange(&head_.word, old, pack(0, old)))
+                cpu_relax();
+
+            const index_type first = index_of(old);
+            index_type done = 0;
+            index_type i = first;
+            size_type count = 0;
+            try
+            {
+                for (; i != 0; ++count)
+                {
+                    node *n = node_at(i);
+                    *out = n->value;
+                    ++out;
+                    value_alloc_.destroy(&n->value);
+                    done = i;
+                    i = atomic_load_relaxed(&n->next);
+                }
+            }
+            catch (...)
+            {
+                index_type rest = i;
+                while (atomic_load_relaxed(&node_at(rest)->next) != 0)
+                    rest = atomic_load_relaxed(&node_at(rest)->next);
+                push_chain(&head_.word, i, rest);
+                if (done != 0)
+                    push_chain(&free_.word, first, done);
+                throw;
+            }
+            if (done != 0)
+                push_chain(&free_.word, first, done);
+            return count;
+        }
+
+        // A snapshot: other threads may change it right after
+        bool empty() const
+        {
+            return index_of(atomic_load(&head_.word)) == 0;
+        }
+
+        allocator_type get_allocator() const
+        {
+            return value_alloc_;
+        }
+
+    private:
+        concurrent_stack(const concurrent_stack &);
+        concurrent_stack &operator=(const concurrent_stack &);
+
+        static index_type index_of(word_type word)
+        {
+            return index_type(word);
+        }
+
+        // New head word for index, with the tag of old bumped
+        static word_type pack(index_type index, word_type old)
+        {
+            return (((old >> 32) + 1) << 32) | index;
+        }
+
+        node *node_at(index_type i) const
+        {
+            const index_type j = i + (first_chunk - 1);
+            const unsigned int k = (31 - __builtin_clz(j)) - first_chunk_shift;
+            return atomic_load_relaxed(&chunks_[k]) + (j - (index_type(first_chunk) << k));
+        }
+
+        // Links the chain first -> ... -> last (already linked through next) on top of list
+        void push_chain(word_type *list, index_type first, index_type last)
+        {
+            word_type old = atomic_load(list);
+            for (;;)
+            {
+                atomic_store_relaxed(&node_at(last)->next, index_of(old));
+                if (atomic_compare_exchange(list, old, pack(first, old)))
+                    return;
+                cpu_relax();
+            }
+        }
+
+        /**
+         * @brief Unlinks the top node of list, 0 when empty. The next index read from a node that
+         * another thread popped meanwhile may be stale, but then the tag has moved and the CAS fails.
+         * Nodes are never freed while the stack lives, so that read is always of valid memory.
+         */
+        index_type pop_node(word_type *list)
+        {
+            word_type old = atomic_load(list);
+            for (;;)
+            {
+                const index_type top = index_of(old);
+                if (top == 0)
+                    return 0;
+                const index_type next = atomic_load_relaxed(&node_at(top)->next);
+                if (atomic_compare_exchange(list, old, pack(next, old)))
+                    return top;
+                cpu_relax();
+            }
+        }
+
+        index_type acquire_node()
+        {
+            const index_type i = pop_node(&free_.word);
+            return i != 0 ? i : grow();
+        }
+
+        // Adds the next chunk: returns its first node and frees the others
+        index_type grow()
+        {
+            lock_guard<mutex> lock(grow_mutex_);
+            const index_type recycled = pop_node(&free_.word);
+            if (recycled != 0)
+                return recycled;
+            if (chunk_count_ == max_chunks)
+                throw std::length_error("ft::concurrent_stack cannot hold more nodes");
+
+            const size_type k = chunk_count_;
+            const size_type count = size_type(first_chunk) << k;
+            atomic_store(&chunks_[k], node_alloc_.allocate(count));
+            chunk_count_ = k + 1;
+
+            const index_type base = index_type(count - first_chunk + 1);
+            for (index_type i = base + 1; i + 1 < base + count; ++i)
+                atomic_store_relaxed(&node_at(i)->next, i + 1);
+            if (count > 1)
+                push_chain(&free_.word, base + 1, index_type(base + count - 1));
+            return base;
+        }
+
+    private:
+        padded_word head_;
+        padded_word free_;
+        allocator_type value_alloc_;
+        node_allocator node_alloc_;
+        node *chunks_[max_chunks];
+        size_type chunk_count_; // Guarded by grow_mutex_
+        mutex grow_mutex_;
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
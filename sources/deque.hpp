@@ -0,0 +1,949 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:40 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef DEQUE_HPP
+# define DEQUE_HPP
+
+# include <algorithm>
+# include <cstddef>
+# include <memory>
+# include <stdexcept>
+
+# include "allocator_traits.hpp"
+# include "iterator.hpp"
+# include "polymorphic_allocator.hpp"
+# include "type_trait.hpp"
+# include "utility.hpp"
+
+/**
+ * @brief Double-ended queue stored as fixed-size blocks reached through a map of block pointers.
+ * push_back, push_front, pop_back and pop_front are O(1) and never move an existing element:
+ * growth allocates one new block and, when the map runs out of slots, reallocates only the map.
+ * References and pointers to elements stay valid across pushes and pops at either end, which
+ * makes it a spike-free container for ft::stack and ft::queue-like use.
+ *
+ * Inserting or erasing in the middle shifts the shorter side. Any insertion invalidates all
+ * iterators (but not references, when it happens at an end); erasure invalidates the erased
+ * elements and, in the middle, everything.
+ *
+ * One emptied block is kept as a spare, so a size oscillating around a block boundary does not
+ * hit the allocator on every push and pop. shrink_to_fit() returns it.
+ *
+ * @link https://en.cppreference.com/w/cpp/container/deque @endlink
+ * @link https://cplusplus.com/reference/deque/deque/ @endlink
+ */
+
+namespace ft
+{
+    template <typename T, typename Allocator>
+    class deque;
+
+    // Elements per block: 512 bytes worth, but never fewer than 16
+    template <typename T>
+    struct deque_block_size
+    {
+        enum { value = sizeof(T) < 32 ? 512 / sizeof(T) : 16 };
+    };
+
+    // Element, the bounds of its block and the map slot of that block. Stepping off either end of
+    // a block moves to the neighbouring map slot.
+    template <typename T, typename Ref, typename Ptr>
+    class deque_iterator
+    {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef T                               value_type;
+        typedef std::ptrdiff_t                  difference_type;
+        typedef Ptr                             pointer;
+        typedef Ref                             reference;
+
+    private:
+        typedef T **map_pointer;
+
+        enum { block_size = deque_block_size<T>::value };
+
+        template <typename, typename, typename>
+        friend class deque_iterator;
+
+        template <typename, typename>
+        friend class deque;
+
+    public:
+        deque_iterator() : cur_(NULL), first_(NULL), last_(NULL), node_(NULL)
+        {
+        }
+
+        // Copy, and mutable to const
+        deque_iterator(const deque_iterator<T, T &, T *> &other)
+            : cur_(other.cur_), first_(other.first_), last_(other.last_), node_(other.node_)
+        {
+        }
+
+    public:
+        reference operator*() const
+        {
+            return *cur_;
+        }
+
+        pointer operator->() const
+        {
+            return cur_;
+        }
+
+        reference operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        deque_iterator &operator++()
+        {
+            ++cur_;
+            if (cur_ == last_)
+            {
+                set_node(node_ + 1);
+                cur_ = first_;
+            }
+            return *this;
+        }
+
+        deque_iterator operator++(int)
+        {
+            deque_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        deque_iterator &operator--()
+        {
+            if (cur_ == first_)
+            {
+                set_node(node_ - 1);
+                cur_ = last_;
+            }
+            --cur_;
+            return *this;
+        }
+
+        deque_iterator operator--(int)
+        {
+            deque_iterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        deque_iterator &operator+=(difference_type n)
+        {
+            const difference_type block = block_size;
+            const difference_type offset = n + (cur_ - first_);
+            if (offset >= 0 && offset < block)
+                cur_ += n;
+            else
+            {
+                const difference_type node_offset = offset > 0 ? offset / block : -((-offset - 1) / block) - 1;
+                set_node(node_ + node_offset);
+                cur_ = first_ + (offset - node_offset * block);
+            }
+            return *this;
+        }
+
+        deque_iterator &operator-=(difference_type n)
+        {
+            return *this += -n;
+        }
+
+        deque_iterator operator+(difference_type n) const
+        {
+            deque_iterator tmp = *this;
+            return tmp += n;
+        }
+
+        deque_iterator operator-(difference_type n) const
+        {
+            deque_iterator tmp = *this;
+            return tmp -= n;
+        }
+
+        // Full blocks between the two, plus the partial ones at each end
+        template <typename R, typename P>
+        difference_type operator-(const deque_iterator<T, R, P> &rhs) const
+        {
+            return difference_type(block_size) * (node_ - rhs.node_ - (node_ != NULL))
+                   + (cur_ - first_) + (rhs.last_ - rhs.cur_);
+        }
+
+        template <typename R, typename P>
+        bool operator==(const deque_iterator<T, R, P> &rhs) const
+        {
+            return cur_ == rhs.cur_;
+        }
+
+        template <typename R, typename P>
+        bool operator!=(const deque_iterator<T, R, P> &rhs) const
+        {
+            return cur_ != rhs.cur_;
+        }
+
+        template <typename R, typename P>
+        bool operator<(const deque_iterator<T, R, P> &rhs) const
+        {
+            return node_ == rhs.node_ ? cur_ < rhs.cur_ : node_ < rhs.node_;
+        }
+
+        template <typename R, typename P>
+        bool operator>(const deque_iterator<T, R, P> &rhs) const
+        {
+            return rhs < *this;
+        }
+
+        template <typename R, typename P>
+        bool operator<=(const deque_iterator<T, R, P> &rhs) const
+        {
+            return !(rhs < *this);
+        }
+
+        template <typename R, typename P>
+        bool operator>=(const deque_iterator<T, R, P> &rhs) const
+        {
+            return !(*this < rhs);
+        }
+
+    private:
+        void set_node(map_pointer node)
+        {
+            node_ = node;
+            first_ = *node;
+            last_ = first_ + block_size;
+        }
+
+    private:
+        T *cur_;
+        T *first_;
+        T *last_;
+        map_pointer node_;
+    };
+
+    template <typename T, typename Ref, typename Ptr>
+    inline deque_iterator<T, Ref, Ptr> operator+(typename deque_iterator<T, Ref, Ptr>::difference_type n,
+                                                 const deque_iterator<T, Ref, Ptr> &it)
+    {
+        return it + n;
+    }
+
+    template <typename T, typename Allocator = std::allocator<T> >
+    class deque
+    {
+    public:
+        typedef T                                         value_type;
+        typedef Allocator                                 allocator_type;
+        typedef typename allocator_type::size_type        size_type;
+        typedef typename allocator_type::difference_type  difference_type;
+        typedef value_type&                               reference;
+        typedef const value_type&                         const_reference;
+        typedef typename allocator_type::pointer          pointer;
+        typedef typename allocator_type::const_pointer    const_pointer;
+        typedef deque_iterator<T, T &, T *>               iterator;
+        typedef deque_iterator<T, const T &, const T *>   const_iterator;
+        typedef ft::reverse_iterator<iterator>            reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    private:
+        typedef allocator_traits<allocator_type>                        alloc_traits;
+        typedef typename allocator_type::template rebind<T *>::other    map_allocator;
+        typedef T                                                     **map_pointer;
+
+        enum { block_size = deque_block_size<T>::value, initial_map_size = 8 };
+
+    public:
+        deque()
+            : alloc_(), map_alloc_(alloc_), map_(NULL), map_size_(0), start_(), finish_(), spare_(NULL)
+        {
+        }
+
+        explicit deque(const allocator_type &alloc)
+            : alloc_(alloc), map_alloc_(alloc_), map_(NULL), map_size_(0), start_(), finish_(), spare_(NULL)
+        {
+        }
+
+        explicit deque(size_type count, const value_type &value = value_type(),
+                       const allocator_type &alloc = allocator_type())
+            : alloc_(alloc), map_alloc_(alloc_), map_(NULL), map_size_(0), start_(), finish_(), spare_(NULL)
+        {
+            fill_init(count, value);
+        }
+
+        template <typename InputIt>
+        deque(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last,
+              const allocator_type &alloc = allocator_type())
+            : alloc_(alloc), map_alloc_(alloc_), map_(NULL), map_size_(0), start_(), finish_(), spare_(NULL)
+        {
+            range_init(first, last);
+        }
+
+        deque(const deque &other)
+            : alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)),
+              map_alloc_(alloc_), map_(NULL), map_size_(0), start_(), finish_(), spare_(NULL)
+        {
+            range_init(other.begin(), other.end());
+        }
+
+        // Allocator-extended copy: the elements of other, in memory from alloc
+        deque(const deque &other, const allocator_type &alloc)
+            : alloc_(alloc), map_alloc_(alloc_), map_(NULL), map_size_(0), start_(), finish_(), spare_(NULL)
+        {
+            range_init(other.begin(), other.end());
+        }
+
+        ~deque()
+        {
+            destroy_elements();
+            release_storage();
+        }
+
+        deque &operator=(const deque &other)
+        {
+            if (this == &other)
+                return *this;
+
+            clear();
+            if (alloc_traits::propagate_on_container_copy_assignment::value)
+            {
+                // Memory of the current allocator goes back to it before it is replaced
+                if (!alloc_traits::equal(alloc_, other.alloc_))
+                    release_storage();
+                alloc_ = other.alloc_;
+                map_alloc_ = map_allocator(alloc_);
+            }
+            append(other.begin(), other.end());
+            return *this;
+        }
+
+        void assign(size_type count, const value_type &value)
+        {
+            clear();
+            for (; count > 0; --count)
+                push_back(value);
+        }
+
+        template <typename InputIt>
+        void assign(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+        {
+            clear();
+            append(first, last);
+        }
+
+        allocator_type get_allocator() const
+        {
+            return alloc_;
+        }
+
+    // Element access
+    public:
+        reference at(size_type pos)
+        {
+            check_range(pos);
+            return start_[difference_type(pos)];
+        }
+
+        const_reference at(size_type pos) const
+        {
+            check_range(pos);
+            return const_iterator(start_)[difference_type(pos)];
+        }
+
+        reference operator[](size_type pos)
+        {
+            return start_[difference_type(pos)];
+        }
+
+        const_reference operator[](size_type pos) const
+        {
+            return const_iterator(start_)[difference_type(pos)];
+        }
+
+        reference front()
+        {
+            return *start_.cur_;
+        }
+
+        const_reference front() const
+        {
+            return *start_.cur_;
+        }
+
+        reference back()
+        {
+            iterator tmp = finish_;
+            --tmp;
+            return *tmp;
+        }
+
+        const_reference back() const
+        {
+            const_iterator tmp = finish_;
+            --tmp;
+            return *tmp;
+        }
+
+    // Iterators
+    public:
+        iterator begin()
+        {
+            return start_;
+        }
+
+        const_iterator begin() const
+        {
+            return start_;
+        }
+
+        iterator end()
+        {
+            return finish_;
+        }
+
+        const_iterator end() const
+        {
+            return finish_;
+        }
+
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+    // Capacity
+    public:
+        bool empty() const
+        {
+            return start_ == finish_;
+        }
+
+        size_type size() const
+        {
+            return size_type(finish_ - start_);
+        }
+
+        size_type max_size() const
+        {
+            return alloc_.max_size();
+        }
+
+        // Returns the spare block, and every block when empty
+        void shrink_to_fit()
+        {
+            if (empty())
+                release_storage();
+            else if (spare_ != NULL)
+            {
+                alloc_.deallocate(spare_, block_size);
+                spare_ = NULL;
+            }
+        }
+
+    // Modifiers
+    public:
+        void clear()
+        {
+            if (map_ == NULL)
+                return;
+            destroy_elements();
+            for (map_pointer node = start_.node_ + 1; node <= finish_.node_; ++node)
+                deallocate_block(*node);
+            finish_ = start_;
+        }
+
+        void push_back(const value_type &value)
+        {
+            if (map_ == NULL)
+                initialize_map();
+            if (finish_.cur_ != finish_.last_ - 1)
+            {
+                alloc_.construct(finish_.cur_, value);
+                ++finish_.cur_;
+            }
+            else
+                push_back_block(value);
+        }
+
+        void push_front(const value_type &value)
+        {
+            if (map_ == NULL)
+                initialize_map();
+            if (start_.cur_ != start_.first_)
+            {
+                alloc_.construct(start_.cur_ - 1, value);
+                --start_.cur_;
+            }
+            else
+                push_front_block(value);
+        }
+
+        void pop_back()
+        {
+            if (finish_.cur_ == finish_.first_)
+            {
+                deallocate_block(finish_.first_);
+                finish_.set_node(finish_.node_ - 1);
+                finish_.cur_ = finish_.last_;
+            }
+            --finish_.cur_;
+            alloc_.destroy(finish_.cur_);
+        }
+
+        void pop_front()
+        {
+            alloc_.destroy(start_.cur_);
+            if (start_.cur_ != start_.last_ - 1)
+                ++start_.cur_;
+            else
+            {
+                deallocate_block(start_.first_);
+                start_.set_node(start_.node_ + 1);
+                start_.cur_ = start_.first_;
+            }
+        }
+
+        iterator insert(iterator pos, const value_type &value)
+        {
+            const difference_type index = pos - begin();
+            insert(pos, 1, value);
+            return begin() + index;
+        }
+
+        // The new elements are pushed at the nearer end, then rotated into place
+        void insert(iterator pos, size_type count, const value_type &value)
+        {
+            const difference_type index = pos - begin();
+            const size_type old_size = size();
+            if (size_type(index) < old_size / 2)
+            {
+                size_type pushed = 0;
+                try
+                {
+                    for (; pushed < count; ++pushed)
+                        push_front(value);
+                }
+                catch (...)
+                {
+                    for (; pushed > 0; --pushed)
+                        pop_front();
+                    throw;
+                }
+                std::rotate(begin(), begin() + difference_type(count), begin() + (difference_type(count) + index));
+            }
+            else
+            {
+                try
+                {
+                    for (size_type pushed = 0; pushed < count; ++pushed)
+                        push_back(value);
+                }
+                catch (...)
+                {
+                    while (size() > old_size)
+                        pop_back();
+                    throw;
+                }
+                std::rotate(begin() + index, begin() + difference_type(old_size), end());
+            }
+        }
+
+        template <typename InputIt>
+        void insert(iterator pos, InputIt first,
+                    typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+        {
+            const difference_type index = pos - begin();
+            const size_type old_size = size();
+            if (size_type(index) < old_size / 2)
+            {
+                try
+                {
+                    for (; first != last; ++first)
+                        push_front(*first);
+                }
+                catch (...)
+                {
+                    while (size() > old_size)
+                        pop_front();
+                    throw;
+                }
+                const difference_type count = difference_type(size() - old_size);
+                std::reverse(begin(), begin() + count);
+                std::rotate(begin(), begin() + count, begin() + (count + index));
+            }
+            else
+            {
+                try
+                {
+                    for (; first != last; ++first)
+                        push_back(*first);
+                }
+                catch (...)
+                {
+                    while (size() > old_size)
+                        pop_back();
+                    throw;
+                }
+                std::rotate(begin() + index, begin() + difference_type(old_size), end());
+            }
+        }
+
+        // The shorter side moves over the gap
+        iterator erase(iterator pos)
+        {
+            iterator next = pos;
+            ++next;
+            const difference_type index = pos - begin();
+            if (size_type(index) < size() / 2)
+            {
+                std::copy_backward(begin(), pos, next);
+                pop_front();
+            }
+            else
+            {
+                std::copy(next, end(), pos);
+                pop_back();
+            }
+            return begin() + index;
+        }
+
+        iterator erase(iterator first, iterator last)
+        {
+            if (first == begin() && last == end())
+            {
+                clear();
+                return end();
+            }
+            const difference_type count = last - first;
+            const difference_type index = first - begin();
+            if (size_type(index) < (size() - count) / 2)
+            {
+                std::copy_backward(begin(), first, last);
+                for (difference_type i = 0; i < count; ++i)
+                    pop_front();
+            }
+            else
+            {
+                std::copy(last, end(), first);
+                for (difference_type i = 0; i < count; ++i)
+                    pop_back();
+            }
+            return begin() + index;
+        }
+
+        void resize(size_type count, value_type value = value_type())
+        {
+            const size_type old_size = size();
+            if (count < old_size)
+                erase(begin() + difference_type(count), end());
+            else
+                insert(end(), count - old_size, value);
+        }
+
+        void swap(deque &other)
+        {
+            if (alloc_traits::propagate_on_container_swap::value)
+            {
+                std::swap(alloc_, other.alloc_);
+                std::swap(map_alloc_, other.map_alloc_);
+            }
+            std::swap(map_, other.map_);
+            std::swap(map_size_, other.map_size_);
+            std::swap(start_, other.start_);
+            std::swap(finish_, other.finish_);
+            std::swap(spare_, other.spare_);
+        }
+
+    private:
+        void check_range(size_type pos) const
+        {
+            if (pos >= size())
+                throw std::out_of_range("Index is out of deque range");
+        }
+
+        void fill_init(size_type count, const value_type &value)
+        {
+            try
+            {
+                for (; count > 0; --count)
+                    push_back(value);
+            }
+            catch (...)
+            {
+                destroy_elements();
+                release_storage();
+                throw;
+            }
+        }
+
+        template <typename InputIt>
+        void range_init(InputIt first, InputIt last)
+        {
+            try
+            {
+                append(first, last);
+            }
+            catch (...)
+            {
+                destroy_elements();
+                release_storage();
+                throw;
+            }
+        }
+
+        template <typename InputIt>
+        void append(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        // One empty block in the middle of a small map, so both ends have room to grow
+        void initialize_map()
+        {
+            map_ = map_alloc_.allocate(initial_map_size);
+            map_size_ = initial_map_size;
+            std::fill(map_, map_ + map_size_, static_cast<T *>(NULL));
+            map_pointer node = map_ + map_size_ / 2;
+            try
+            {
+                *node = allocate_block();
+            }
+            catch (...)
+            {
+                map_alloc_.deallocate(map_, map_size_);
+                map_ = NULL;
+                map_size_ = 0;
+                throw;
+            }
+            start_.set_node(node);
+            start_.cur_ = start_.first_ + block_size / 2;
+            finish_ = start_;
+        }
+
+        T *allocate_block()
+        {
+            if (spare_ == NULL)
+                return alloc_.allocate(block_size);
+            T *block = spare_;
+            spare_ = NULL;
+            return block;
+        }
+
+        void deallocate_block(T *block)
+        {
+            if (spare_ == NULL)
+                spare_ = block;
+            else
+                alloc_.deallocate(block, block_size);
+        }
+
+        // finish_ always points into an allocated block: the last slot of a block is filled only
+        // once the next block exists.
+        void push_back_block(const value_type &value)
+        {
+            reserve_map_at_back();
+            *(finish_.node_ + 1) = allocate_block();
+            try
+            {
+                alloc_.construct(finish_.cur_, value);
+            }
+            catch (...)
+            {
+                deallocate_block(*(finish_.node_ + 1));
+                throw;
+            }
+            finish_.set_node(finish_.node_ + 1);
+            finish_.cur_ = finish_.first_;
+        }
+
+        void push_front_block(const value_type &value)
+        {
+            reserve_map_at_front();
+            *(start_.node_ - 1) = allocate_block();
+            try
+            {
+                alloc_.construct(*(start_.node_ - 1) + (block_size - 1), value);
+            }
+            catch (...)
+            {
+                deallocate_block(*(start_.node_ - 1));
+                throw;
+            }
+            start_.set_node(start_.node_ - 1);
+            start_.cur_ = start_.last_ - 1;
+        }
+
+        void reserve_map_at_back()
+        {
+            if (finish_.node_ + 1 == map_ + map_size_)
+                reallocate_map(false);
+        }
+
+        void reserve_map_at_front()
+        {
+            if (start_.node_ == map_)
+                reallocate_map(true);
+        }
+
+        /**
+         * @brief Makes room for one more block slot at one end. Only block pointers move, never
+         * elements. A map less than half used is recentred in place, otherwise it doubles.
+         */
+        void reallocate_map(bool add_at_front)
+        {
+            const size_type old_nodes = size_type(finish_.node_ - start_.node_) + 1;
+            const size_type new_nodes = old_nodes + 1;
+            map_pointer new_start;
+            if (map_size_ > 2 * new_nodes)
+            {
+                new_start = map_ + (map_size_ - new_nodes) / 2 + (add_at_front ? 1 : 0);
+                if (new_start < start_.node_)
+                    std::copy(start_.node_, finish_.node_ + 1, new_start);
+                else
+                    std::copy_backward(start_.node_, finish_.node_ + 1, new_start + old_nodes);
+            }
+            else
+            {
+                const size_type new_map_size = map_size_ * 2 + 2;
+                map_pointer new_map = map_alloc_.allocate(new_map_size);
+                std::fill(new_map, new_map + new_map_size, static_cast<T *>(NULL));
+                new_start = new_map + (new_map_size - new_nodes) / 2 + (add_at_front ? 1 : 0);
+                std::copy(start_.node_, finish_.node_ + 1, new_start);
+                map_alloc_.deallocate(map_, map_size_);
+                map_ = new_map;
+                map_size_ = new_map_size;
+            }
+            start_.set_node(new_start);
+            finish_.set_node(new_start + old_nodes - 1);
+        }
+
+        void destroy_range(T *first, T *last)
+        {
+            if (is_trivially_destructible<value_type>::value)
+                return;
+            for (; first != last; ++first)
+                alloc_.destroy(first);
+        }
+
+        void destroy_elements()
+        {
+            if (map_ == NULL)
+                return;
+            for (map_pointer node = start_.node_ + 1; node < finish_.node_; ++node)
+                destroy_range(*node, *node + block_size);
+            if (start_.node_ == finish_.node_)
+                destroy_range(start_.cur_, finish_.cur_);
+            else
+            {
+                destroy_range(start_.cur_, start_.last_);
+                destroy_range(finish_.first_, finish_.cur_);
+            }
+        }
+
+        // Blocks, spare and map; the elements must already be destroyed
+        void release_storage()
+        {
+            if (map_ != NULL)
+            {
+                for (map_pointer node = start_.node_; node <= finish_.node_; ++node)
+                    alloc_.deallocate(*node, block_size);
+                map_alloc_.deallocate(map_, map_size_);
+            }
+            if (spare_ != NULL)
+                alloc_.deallocate(spare_, block_size);
+            map_ = NULL;
+            map_size_ = 0;
+            start_ = iterator();
+            finish_ = iterator();
+            spare_ = NULL;
+        }
+
+    private:
+        allocator_type alloc_;
+        map_allocator map_alloc_;
+        map_pointer map_;
+        size_type map_size_;
+        iterator start_;
+        iterator finish_;
+        T *spare_;
+    };
+
+    template <typename T, typename Allocator>
+    inline bool operator==(const deque<T, Allocator> &lhs, const deque<T, Allocator> &rhs)
+    {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const deque<T, Allocator> &lhs, const deque<T, Allocator> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator<(const deque<T, Allocator> &lhs, const deque<T, Allocator> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator<=(const deque<T, Allocator> &lhs, const deque<T, Allocator> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator>(const deque<T, Allocator> &lhs, const deque<T, Allocator> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator>=(const deque<T, Allocator> &lhs, const deque<T, Allocator> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename T, typename Allocator>
+    inline void swap(deque<T, Allocator> &lhs, deque<T, Allocator> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    namespace pmr
+    {
+        // ft::deque allocating from a memory_resource
+        template <typename T>
+        struct deque
+        {
+            typedef ft::deque<T, polymorphic_allocator<T> > type;
+        };
+    } // namespace pmr
+} // namespace ft
+
+#endif
\ No newline at end of file
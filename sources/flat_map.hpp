@@ -0,0 +1,708 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_map.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:27:05 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 16:27:05 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLAT_MAP_HPP
+# define FLAT_MAP_HPP
+
+# include <algorithm>
+# include <functional>
+# include <iterator>
+# include <memory>
+# include <stdexcept>
+
+# include "type_trait.hpp"
+# include "iterator.hpp"
+# include "polymorphic_allocator.hpp"
+# include "random_access_iterator.hpp"
+# include "utility.hpp"
+# include "vector.hpp"
+
+/**
+ * @brief Sorted map over two parallel ft::vectors, one of keys and one of mapped values. A lookup
+ * is a binary search over the key array only, so every cache line it touches is full of keys; the
+ * values are read once, at the end. There is no per-element node. Like flat_set, single inserts
+ * and erases are O(n) and bulk loads should use the O(n + m) merging insert overloads.
+ *
+ * Elements are not stored as pairs, so iterators dereference to a {first, second} pair of
+ * references rather than to a value_type&. Any insertion or erasure invalidates all iterators.
+ *
+ * @link https://en.cppreference.com/w/cpp/container/flat_map @endlink
+ * @link https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2022/p0429r9.pdf @endlink
+ */
+
+namespace ft
+{
+    // What a flat_map iterator points to; Value is T or const T
+    template <typename Key, typename Value>
+    struct flat_map_reference
+    {
+        const Key &first;
+        Value &second;
+
+        flat_map_reference(const Key &k, Value &v) : first(k), second(v)
+        {
+        }
+
+        template <typename T>
+        operator pair<const Key, T>() const
+        {
+            return pair<const Key, T>(first, second);
+        }
+
+        const flat_map_reference *operator->() const
+        {
+            return this;
+        }
+    };
+
+    template <typename Key, typename V1, typename V2>
+    inline bool operator==(const flat_map_reference<Key, V1> &lhs, const flat_map_reference<Key, V2> &rhs)
+    {
+        return lhs.first == rhs.first && lhs.second == rhs.second;
+    }
+
+    template <typename Key, typename V1, typename V2>
+    inline bool operator<(const flat_map_reference<Key, V1> &lhs, const flat_map_reference<Key, V2> &rhs)
+    {
+        return (lhs.first < rhs.first) || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+    }
+
+    // Pointer-like pair of positions in the key and value arrays, the It of random_access_iterator
+    template <typename Key, typename Value>
+    class flat_map_pointer
+    {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef pair<const Key, Value>          value_type;
+        typedef std::ptrdiff_t                  difference_type;
+        typedef flat_map_pointer                pointer;
+        typedef flat_map_reference<Key, Value>  reference;
+
+    public:
+        flat_map_pointer() : key_(NULL), value_(NULL)
+        {
+        }
+
+        flat_map_pointer(const Key *key, Value *value) : key_(key), value_(value)
+        {
+        }
+
+        // Mutable to const
+        template <typename V>
+        flat_map_pointer(const flat_map_pointer<Key, V> &other) : key_(other.key()), value_(other.value())
+        {
+        }
+
+    public:
+        const Key *key() const
+        {
+            return key_;
+        }
+
+        Value *value() const
+        {
+            return value_;
+        }
+
+        reference operator*() const
+        {
+            return reference(*key_, *value_);
+        }
+
+        reference operator->() const
+        {
+            return operator*();
+        }
+
+        reference operator[](difference_type n) const
+        {
+            return reference(key_[n], value_[n]);
+        }
+
+        flat_map_pointer &operator++()
+        {
+            ++key_;
+            ++value_;
+            return *this;
+        }
+
+        flat_map_pointer operator++(int)
+        {
+            flat_map_pointer tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        flat_map_pointer &operator--()
+        {
+            --key_;
+            --value_;
+            return *this;
+        }
+
+        flat_map_pointer operator--(int)
+        {
+            flat_map_pointer tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        flat_map_pointer &operator+=(difference_type n)
+        {
+            key_ += n;
+            value_ += n;
+            return *this;
+        }
+
+        flat_map_pointer &operator-=(difference_type n)
+        {
+            key_ -= n;
+            value_ -= n;
+            return *this;
+        }
+
+        flat_map_pointer operator+(difference_type n) const
+        {
+            return flat_map_pointer(key_ + n, value_ + n);
+        }
+
+        flat_map_pointer operator-(difference_type n) const
+        {
+            return flat_map_pointer(key_ - n, value_ - n);
+        }
+
+    private:
+        const Key *key_;
+        Value *value_;
+    };
+
+    // Both arrays move together, so the key position alone orders and measures
+    template <typename Key, typename V1, typename V2>
+    inline std::ptrdiff_t operator-(const flat_map_pointer<Key, V1> &lhs, const flat_map_pointer<Key, V2> &rhs)
+    {
+        return lhs.key() - rhs.key();
+    }
+
+    template <typename Key, typename V1, typename V2>
+    inline bool operator==(const flat_map_pointer<Key, V1> &lhs, const flat_map_pointer<Key, V2> &rhs)
+    {
+        return lhs.key() == rhs.key();
+    }
+
+    template <typename Key, typename V1, typename V2>
+    inline bool operator!=(const flat_map_pointer<Key, V1> &lhs, const flat_map_pointer<Key, V2> &rhs)
+    {
+        return lhs.key() != rhs.key();
+    }
+
+    template <typename Key, typename V1, typename V2>
+    inline bool operator<(const flat_map_pointer<Key, V1> &lhs, const flat_map_pointer<Key, V2> &rhs)
+    {
+        return lhs.key() < rhs.key();
+    }
+
+    template <typename Key, typename V1, typename V2>
+    inline bool operator<=(const flat_map_pointer<Key, V1> &lhs, const flat_map_pointer<Key, V2> &rhs)
+    {
+        return lhs.key() <= rhs.key();
+    }
+
+    template <typename Key, typename V1, typename V2>
+    inline bool operator>(const flat_map_pointer<Key, V1> &lhs, const flat_map_pointer<Key, V2> &rhs)
+    {
+        return lhs.key() > rhs.key();
+    }
+
+    template <typename Key, typename V1, typename V2>
+    inline bool operator>=(const flat_map_pointer<Key, V1> &lhs, const flat_map_pointer<Key, V2> &rhs)
+    {
+        return lhs.key() >= rhs.key();
+    }
+
+    template <typename Key, typename T, typename Compare = std::less<Key>,
+              typename Allocator = std::allocator<pair<const Key, T> > >
+    class flat_map
+    {
+    public:
+        typedef Key                                      key_type;
+        typedef T                                        mapped_type;
+        typedef pair<const key_type, mapped_type>        value_type;
+        typedef Compare                                  key_compare;
+        typedef Allocator                                allocator_type;
+        typedef typename allocator_type::size_type       size_type;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef flat_map_reference<key_type, mapped_type>       reference;
+        typedef flat_map_reference<key_type, const mapped_type> const_reference;
+        typedef flat_map_pointer<key_type, mapped_type>         pointer;
+        typedef flat_map_pointer<key_type, const mapped_type>   const_pointer;
+
+        typedef random_access_iterator<pointer, flat_map>       iterator;
+        typedef random_access_iterator<const_pointer, flat_map> const_iterator;
+        typedef ft::reverse_iterator<iterator>                  reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+
+        typedef vector<key_type, typename allocator_type::template rebind<key_type>::other>       key_container_type;
+        typedef vector<mapped_type, typename allocator_type::template rebind<mapped_type>::other> mapped_container_type;
+
+        class value_compare : public std::binary_function<value_type, value_type, bool>
+        {
+            friend class flat_map;
+
+        public:
+            typedef value_type first_argument_type;
+            typedef value_type second_argument_type;
+            typedef bool result_type;
+
+        public:
+            bool operator()(const value_type &x, const value_type &y) const
+            {
+                return comp(x.first, y.first);
+            }
+
+        protected:
+            value_compare(const key_compare &c)
+                : comp(c)
+            {
+            }
+
+        protected:
+            key_compare comp;
+        };
+
+    private:
+        typedef pair<key_type, mapped_type> entry;
+        typedef vector<entry, typename allocator_type::template rebind<entry>::other> entry_vector;
+
+        struct entry_compare
+        {
+            key_compare comp;
+
+            entry_compare(const key_compare &c) : comp(c)
+            {
+            }
+
+            bool operator()(const entry &x, const entry &y) const
+            {
+                return comp(x.first, y.first);
+            }
+        };
+
+    public:
+        flat_map()
+            : comp_(), keys_(), values_()
+        {
+        }
+
+        explicit flat_map(const key_compare &comp, const allocator_type &alloc = allocator_type())
+            : comp_(comp), keys_(alloc), values_(alloc)
+        {
+        }
+
+        template <typename InputIt>
+        flat_map(InputIt first, InputIt last, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type())
+            : comp_(comp), keys_(alloc), values_(alloc)
+        {
+            insert(first, last);
+        }
+
+        template <typename InputIt>
+        flat_map(sorted_unique_t, InputIt first, InputIt last, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type())
+            : comp_(comp), keys_(alloc), values_(alloc)
+        {
+            merge(first, last);
+        }
+
+    public:
+        allocator_type get_allocator() const
+        {
+            return allocator_type(keys_.get_allocator());
+        }
+
+        T &at(const key_type &key)
+        {
+            const size_type i = find_index(key);
+            if (i == keys_.size())
+                throw std::out_of_range("Key not found");
+            return values_[i];
+        }
+
+        const T &at(const key_type &key) const
+        {
+            const size_type i = find_index(key);
+            if (i == keys_.size())
+                throw std::out_of_range("Key not found");
+            return values_[i];
+        }
+
+        T &operator[](const key_type &key)
+        {
+            const size_type i = lower_index(key);
+            if (i == keys_.size() || comp_(key, keys_[i]))
+                insert_at(i, key, mapped_type());
+            return values_[i];
+        }
+
+        iterator begin()
+        {
+            return iterator(pointer(keys_.data(), values_.data()));
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(const_pointer(keys_.data(), values_.data()));
+        }
+
+        iterator end()
+        {
+            return begin() + keys_.size();
+        }
+
+        const_iterator end() const
+        {
+            return begin() + keys_.size();
+        }
+
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        bool empty() const
+        {
+            return keys_.empty();
+        }
+
+        size_type size() const
+        {
+            return keys_.size();
+        }
+
+        size_type max_size() const
+        {
+            return std::min(keys_.max_size(), values_.max_size());
+        }
+
+        size_type capacity() const
+        {
+            return keys_.capacity();
+        }
+
+        void reserve(size_type count)
+        {
+            keys_.reserve(count);
+            values_.reserve(count);
+        }
+
+        // The underlying sorted storage, index i of one matches index i of the other
+        const key_container_type &keys() const
+        {
+            return keys_;
+        }
+
+        const mapped_container_type &values() const
+        {
+            return values_;
+        }
+
+        void clear()
+        {
+            keys_.clear();
+            values_.clear();
+        }
+
+        pair<iterator, bool> insert(const value_type &value)
+        {
+            const size_type i = lower_index(value.first);
+            if (i != keys_.size() && !comp_(value.first, keys_[i]))
+                return ft::make_pair(begin() + i, false);
+            insert_at(i, value.first, value.second);
+            return ft::make_pair(begin() + i, true);
+        }
+
+        // The hint is used when value belongs right before it, otherwise this is a plain insert
+        iterator insert(iterator hint, const value_type &value)
+        {
+            const size_type i = hint - begin();
+            if ((i == keys_.size() || comp_(value.first, keys_[i])) &&
+                (i == 0 || comp_(keys_[i - 1], value.first)))
+            {
+                insert_at(i, value.first, value.second);
+                return begin() + i;
+            }
+            return insert(value).first;
+        }
+
+        // Unsorted input is sorted on the side, then merged; the first of equal keys wins
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            entry_vector sorted;
+            for (; first != last; ++first)
+                sorted.push_back(entry(first->first, first->second));
+            std::stable_sort(sorted.data(), sorted.data() + sorted.size(), entry_compare(comp_));
+            merge(sorted.data(), sorted.data() + sorted.size());
+        }
+
+        // [first, last) must be sorted by key and unique: a single O(n + m) merge
+        template <typename InputIt>
+        void insert(sorted_unique_t, InputIt first, InputIt last)
+        {
+            merge(first, last);
+        }
+
+        void erase(iterator pos)
+        {
+            const size_type i = pos - begin();
+            erase_range(i, i + 1);
+        }
+
+        void erase(iterator first, iterator last)
+        {
+            erase_range(first - begin(), last - begin());
+        }
+
+        size_type erase(const key_type &key)
+        {
+            const size_type i = find_index(key);
+            if (i == keys_.size())
+                return 0;
+            erase_range(i, i + 1);
+            return 1;
+        }
+
+        void swap(flat_map &other)
+        {
+            std::swap(comp_, other.comp_);
+            keys_.swap(other.keys_);
+            values_.swap(other.values_);
+        }
+
+        size_type count(const key_type &key) const
+        {
+            return find_index(key) == keys_.size() ? 0 : 1;
+        }
+
+        iterator find(const key_type &key)
+        {
+            return begin() + find_index(key);
+        }
+
+        const_iterator find(const key_type &key) const
+        {
+            return begin() + find_index(key);
+        }
+
+        pair<iterator, iterator> equal_range(const key_type &key)
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        pair<const_iterator, const_iterator> equal_range(const key_type &key) const
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        iterator lower_bound(const key_type &key)
+        {
+            return begin() + lower_index(key);
+        }
+
+        const_iterator lower_bound(const key_type &key) const
+        {
+            return begin() + lower_index(key);
+        }
+
+        iterator upper_bound(const key_type &key)
+        {
+            return begin() + upper_index(key);
+        }
+
+        const_iterator upper_bound(const key_type &key) const
+        {
+            return begin() + upper_index(key);
+        }
+
+        key_compare key_comp() const
+        {
+            return comp_;
+        }
+
+        value_compare value_comp() const
+        {
+            return value_compare(comp_);
+        }
+
+    private:
+        size_type lower_index(const key_type &key) const
+        {
+            const key_type *first = keys_.data();
+            return std::lower_bound(first, first + keys_.size(), key, comp_) - first;
+        }
+
+        size_type upper_index(const key_type &key) const
+        {
+            const key_type *first = keys_.data();
+            return std::upper_bound(first, first + keys_.size(), key, comp_) - first;
+        }
+
+        size_type find_index(const key_type &key) const
+        {
+            const size_type i = lower_index(key);
+            if (i != keys_.size() && comp_(key, keys_[i]))
+                return keys_.size();
+            return i;
+        }
+
+        // Keeps the two arrays the same length if the second insertion throws
+        void insert_at(size_type i, const key_type &key, const mapped_type &value)
+        {
+            keys_.insert(keys_.begin() + i, key);
+            try
+            {
+                values_.insert(values_.begin() + i, value);
+            }
+            catch (...)
+            {
+                keys_.erase(keys_.begin() + i);
+                throw;
+            }
+        }
+
+        void erase_range(size_type first, size_type last)
+        {
+            key_type *key = keys_.data();
+            mapped_type *value = values_.data();
+            std::copy(key + last, key + keys_.size(), key + first);
+            std::copy(value + last, value + values_.size(), value + first);
+            for (size_type n = last - first; n != 0; --n)
+            {
+                keys_.pop_back();
+                values_.pop_back();
+            }
+        }
+
+        template <typename InputIt>
+        void merge(InputIt first, InputIt last)
+        {
+            key_container_type merged_keys(keys_.get_allocator());
+            mapped_container_type merged_values(values_.get_allocator());
+            merged_keys.reserve(keys_.size());
+            merged_values.reserve(values_.size());
+
+            size_type i = 0;
+            const size_type n = keys_.size();
+            for (; first != last; ++first)
+            {
+                for (; i != n && comp_(keys_[i], first->first); ++i)
+                {
+                    merged_keys.push_back(keys_[i]);
+                    merged_values.push_back(values_[i]);
+                }
+                if (i != n && !comp_(first->first, keys_[i]))
+                    continue; // already present
+                if (!merged_keys.empty() && !comp_(merged_keys.back(), first->first))
+                    continue; // repeated in the input
+                merged_keys.push_back(first->first);
+                merged_values.push_back(first->second);
+            }
+            for (; i != n; ++i)
+            {
+                merged_keys.push_back(keys_[i]);
+                merged_values.push_back(values_[i]);
+            }
+            keys_.swap(merged_keys);
+            values_.swap(merged_values);
+        }
+
+    private:
+        key_compare comp_;
+        key_container_type keys_;
+        mapped_container_type values_;
+    };
+
+    template <typename Key, typename T, typename Compare, typename Allocator>
+    inline void swap(flat_map<Key, T, Compare, Allocator> &x, flat_map<Key, T, Compare, Allocator> &y)
+    {
+        x.swap(y);
+    }
+
+    template <typename Key, typename T, typename Compare, typename Allocator>
+    inline bool operator==(const flat_map<Key, T, Compare, Allocator> &lhs,
+                           const flat_map<Key, T, Compare, Allocator> &rhs)
+    {
+        return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+    }
+
+    template <typename Key, typename T, typename Compare, typename Allocator>
+    inline bool operator!=(const flat_map<Key, T, Compare, Allocator> &lhs,
+                           const flat_map<Key, T, Compare, Allocator> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Key, typename T, typename Compare, typename Allocator>
+    inline bool operator<(const flat_map<Key, T, Compare, Allocator> &lhs,
+                          const flat_map<Key, T, Compare, Allocator> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename Key, typename T, typename Compare, typename Allocator>
+    inline bool operator<=(const flat_map<Key, T, Compare, Allocator> &lhs,
+                           const flat_map<Key, T, Compare, Allocator> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename Key, typename T, typename Compare, typename Allocator>
+    inline bool operator>(const flat_map<Key, T, Compare, Allocator> &lhs,
+                          const flat_map<Key, T, Compare, Allocator> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename Key, typename T, typename Compare, typename Allocator>
+    inline bool operator>=(const flat_map<Key, T, Compare, Allocator> &lhs,
+                           const flat_map<Key, T, Compare, Allocator> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    namespace pmr
+    {
+        // ft::flat_map allocating from a memory_resource
+        template <typename Key, typename T, typename Compare = std::less<Key> >
+        struct flat_map
+        {
+            typedef ft::flat_map<Key, T, Compare, polymorphic_allocator<pair<const Key, T> > > type;
+        };
+    } // namespace pmr
+} // namespace ft
+
+#endif
\ No newline at end of file
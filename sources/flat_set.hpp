@@ -0,0 +1,369 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_set.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:02:47 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 16:02:47 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLAT_SET_HPP
+# define FLAT_SET_HPP
+
+# include <algorithm>
+# include <functional>
+# include <memory>
+
+# include "type_trait.hpp"
+# include "iterator.hpp"
+# include "polymorphic_allocator.hpp"
+# include "random_access_iterator.hpp"
+# include "utility.hpp"
+# include "vector.hpp"
+
+/**
+ * @brief Sorted set stored in one contiguous ft::vector. Lookups are a binary search over dense
+ * memory and there is no per-element node, which makes it smaller and faster to search than a
+ * tree for small sets and for sets that are built once and queried often. Inserting or erasing
+ * one element moves everything after it, so bulk loads should go through insert(first, last) or
+ * insert(sorted_unique, first, last), which merge in O(n + m).
+ *
+ * Any insertion or erasure invalidates all iterators.
+ *
+ * @link https://en.cppreference.com/w/cpp/container/flat_set @endlink
+ * @link https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2022/p1222r4.pdf @endlink
+ */
+
+namespace ft
+{
+    template <typename Key, typename Compare = std::less<Key>, typename Allocator = std::allocator<Key> >
+    class flat_set
+    {
+    public:
+        typedef Key                                      key_type;
+        typedef Key                                      value_type;
+        typedef Compare                                  key_compare;
+        typedef Compare                                  value_compare;
+        typedef Allocator                                allocator_type;
+        typedef typename allocator_type::size_type       size_type;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef value_type&                              reference;
+        typedef const value_type&                        const_reference;
+        typedef typename allocator_type::pointer         pointer;
+        typedef typename allocator_type::const_pointer   const_pointer;
+
+        // Elements are the keys, so they are never modifiable through an iterator
+        typedef random_access_iterator<const_pointer, flat_set> iterator;
+        typedef iterator                                       const_iterator;
+        typedef ft::reverse_iterator<iterator>                 reverse_iterator;
+        typedef reverse_iterator                               const_reverse_iterator;
+
+    private:
+        typedef vector<key_type, allocator_type> key_vector;
+
+    public:
+        flat_set()
+            : comp_(), keys_()
+        {
+        }
+
+        explicit flat_set(const key_compare &comp, const allocator_type &alloc = allocator_type())
+            : comp_(comp), keys_(alloc)
+        {
+        }
+
+        template <typename InputIt>
+        flat_set(InputIt first, InputIt last, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type())
+            : comp_(comp), keys_(alloc)
+        {
+            insert(first, last);
+        }
+
+        template <typename InputIt>
+        flat_set(sorted_unique_t, InputIt first, InputIt last, const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type())
+            : comp_(comp), keys_(alloc)
+        {
+            keys_.assign(first, last);
+        }
+
+    public:
+        allocator_type get_allocator() const
+        {
+            return keys_.get_allocator();
+        }
+
+        iterator begin() const
+        {
+            return iterator(keys_.data());
+        }
+
+        iterator end() const
+        {
+            return iterator(keys_.data() + keys_.size());
+        }
+
+        reverse_iterator rbegin() const
+        {
+            return reverse_iterator(end());
+        }
+
+        reverse_iterator rend() const
+        {
+            return reverse_iterator(begin());
+        }
+
+        bool empty() const
+        {
+            return keys_.empty();
+        }
+
+        size_type size() const
+        {
+            return keys_.size();
+        }
+
+        size_type max_size() const
+        {
+            return keys_.max_size();
+        }
+
+        size_type capacity() const
+        {
+            return keys_.capacity();
+        }
+
+        void reserve(size_type count)
+        {
+            keys_.reserve(count);
+        }
+
+        // The underlying sorted storage
+        const key_vector &keys() const
+        {
+            return keys_;
+        }
+
+        void clear()
+        {
+            keys_.clear();
+        }
+
+        pair<iterator, bool> insert(const value_type &value)
+        {
+            const size_type i = lower_index(value);
+            if (i != keys_.size() && !comp_(value, keys_[i]))
+                return ft::make_pair(at_index(i), false);
+            keys_.insert(keys_.begin() + i, value);
+            return ft::make_pair(at_index(i), true);
+        }
+
+        // The hint is used when value belongs right before it, otherwise this is a plain insert
+        iterator insert(iterator hint, const value_type &value)
+        {
+            const size_type i = hint - begin();
+            if ((i == keys_.size() || comp_(value, keys_[i])) && (i == 0 || comp_(keys_[i - 1], value)))
+            {
+                keys_.insert(keys_.begin() + i, value);
+                return at_index(i);
+            }
+            return insert(value).first;
+        }
+
+        // Unsorted input is sorted on the side, then merged; the first of equal keys wins
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            key_vector sorted(first, last, keys_.get_allocator());
+            std::stable_sort(sorted.data(), sorted.data() + sorted.size(), comp_);
+            merge(sorted.data(), sorted.data() + sorted.size());
+        }
+
+        // [first, last) must be sorted and unique: a single O(n + m) merge
+        template <typename InputIt>
+        void insert(sorted_unique_t, InputIt first, InputIt last)
+        {
+            merge(first, last);
+        }
+
+        void erase(iterator pos)
+        {
+            keys_.erase(keys_.begin() + (pos - begin()));
+        }
+
+        void erase(iterator first, iterator last)
+        {
+            erase_range(first - begin(), last - begin());
+        }
+
+        size_type erase(const key_type &key)
+        {
+            const size_type i = lower_index(key);
+            if (i == keys_.size() || comp_(key, keys_[i]))
+                return 0;
+            keys_.erase(keys_.begin() + i);
+            return 1;
+        }
+
+        void swap(flat_set &other)
+        {
+            std::swap(comp_, other.comp_);
+            keys_.swap(other.keys_);
+        }
+
+        size_type count(const key_type &key) const
+        {
+            return find_index(key) == keys_.size() ? 0 : 1;
+        }
+
+        iterator find(const key_type &key) const
+        {
+            return at_index(find_index(key));
+        }
+
+        pair<iterator, iterator> equal_range(const key_type &key) const
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        iterator lower_bound(const key_type &key) const
+        {
+            return at_index(lower_index(key));
+        }
+
+        iterator upper_bound(const key_type &key) const
+        {
+            const_pointer first = keys_.data();
+            return iterator(std::upper_bound(first, first + keys_.size(), key, comp_));
+        }
+
+        key_compare key_comp() const
+        {
+            return comp_;
+        }
+
+        value_compare value_comp() const
+        {
+            return comp_;
+        }
+
+    private:
+        iterator at_index(size_type i) const
+        {
+            return iterator(keys_.data() + i);
+        }
+
+        size_type lower_index(const key_type &key) const
+        {
+            const_pointer first = keys_.data();
+            return std::lower_bound(first, first + keys_.size(), key, comp_) - first;
+        }
+
+        size_type find_index(const key_type &key) const
+        {
+            const size_type i = lower_index(key);
+            if (i != keys_.size() && comp_(key, keys_[i]))
+                return keys_.size();
+            return i;
+        }
+
+        void erase_range(size_type first, size_type last)
+        {
+            pointer data = keys_.data();
+            std::copy(data + last, data + keys_.size(), data + first);
+            for (size_type n = last - first; n != 0; --n)
+                keys_.pop_back();
+        }
+
+        template <typename InputIt>
+        void merge(InputIt first, InputIt last)
+        {
+            key_vector merged(keys_.get_allocator());
+            merged.reserve(keys_.size());
+
+            const_pointer it = keys_.data();
+            const_pointer end = it + keys_.size();
+            for (; first != last; ++first)
+            {
+                while (it != end && comp_(*it, *first))
+                    merged.push_back(*it++);
+                if (it != end && !comp_(*first, *it))
+                    continue; // already present
+                if (!merged.empty() && !comp_(merged.back(), *first))
+                    continue; // repeated in the input
+                merged.push_back(*first);
+            }
+            for (; it != end; ++it)
+                merged.push_back(*it);
+            keys_.swap(merged);
+        }
+
+    private:
+        key_compare comp_;
+        key_vector keys_;
+    };
+
+    template <typename Key, typename Compare, typename Allocator>
+    inline void swap(flat_set<Key, Compare, Allocator> &x, flat_set<Key, Compare, Allocator> &y)
+    {
+        x.swap(y);
+    }
+
+    template <typename Key, typename Compare, typename Allocator>
+    inline bool operator==(const flat_set<Key, Compare, Allocator> &lhs,
+                           const flat_set<Key, Compare, Allocator> &rhs)
+    {
+        return lhs.keys() == rhs.keys();
+    }
+
+    template <typename Key, typename Compare, typename Allocator>
+    inline bool operator!=(const flat_set<Key, Compare, Allocator> &lhs,
+                           const flat_set<Key, Compare, Allocator> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename Key, typename Compare, typename Allocator>
+    inline bool operator<(const flat_set<Key, Compare, Allocator> &lhs,
+                          const flat_set<Key, Compare, Allocator> &rhs)
+    {
+        return lhs.keys() < rhs.keys();
+    }
+
+    template <typename Key, typename Compare, typename Allocator>
+    inline bool operator<=(const flat_set<Key, Compare, Allocator> &lhs,
+                           const flat_set<Key, Compare, Allocator> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename Key, typename Compare, typename Allocator>
+    inline bool operator>(const flat_set<Key, Compare, Allocator> &lhs,
+                          const flat_set<Key, Compare, Allocator> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename Key, typename Compare, typename Allocator>
+    inline bool operator>=(const flat_set<Key, Compare, Allocator> &lhs,
+                           const flat_set<Key, Compare, Allocator> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    namespace pmr
+    {
+        // ft::flat_set allocating from a memory_resource
+        template <typename Key, typename Compare = std::less<Key> >
+        struct flat_set
+        {
+            typedef ft::flat_set<Key, Compare, polymorphic_allocator<Key> > type;
+        };
+    } // namespace pmr
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:05:19 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 10:05:19 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_HPP
+# define HASH_HPP
+
+# include <cstddef>
+# include <string>
+
+/**
+ * @brief Hash function objects for the hashed and sharded containers. Integers are run through the
+ * splitmix64 finalizer instead of being returned as-is, because the containers take the low bits of
+ * the hash (shard index, table position) and raw integers would cluster.
+ *
+ * Specialize ft::hash<T> to use your own key type.
+ *
+ * @link https://en.cppreference.com/w/cpp/utility/hash @endlink
+ * @link https://prng.di.unimi.it/splitmix64.c @endlink
+ * @link http://www.isthe.com/chongo/tech/comp/fnv/ @endlink
+ */
+
+namespace ft
+{
+    inline std::size_t hash_mix(unsigned long long x)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return static_cast<std::size_t>(x);
+    }
+
+    // FNV-1a over raw bytes
+    inline unsigned long long hash_bytes(const void *data, std::size_t len,
+                                         unsigned long long seed = 0xcbf29ce484222325ULL)
+    {
+        const unsigned char *p = static_cast<const unsigned char *>(data);
+        unsigned long long h = seed;
+        for (std::size_t i = 0; i < len; ++i)
+        {
+            h ^= p[i];
+            h *= 0x100000001b3ULL;
+        }
+        return h;
+    }
+
+    template <typename T>
+    struct hash;
+
+    template <typename T>
+    struct integral_hash
+    {
+        typedef T argument_type;
+        typedef std::size_t result_type;
+
+        std::size_t operator()(T value) const
+        {
+            return hash_mix(static_cast<unsigned long long>(value));
+        }
+    };
+
+    template <> struct hash<bool> : public integral_hash<bool> {};
+    template <> struct hash<char> : public integral_hash<char> {};
+    template <> struct hash<signed char> : public integral_hash<signed char> {};
+    template <> struct hash<unsigned char> : public integral_hash<unsigned char> {};
+    template <> struct hash<short> : public integral_hash<short> {};
+    template <> struct hash<unsigned short> : public integral_hash<unsigned short> {};
+    template <> struct hash<int> : public integral_hash<int> {};
+    template <> struct hash<unsigned int> : public integral_hash<unsigned int> {};
+    template <> struct hash<long> : public integral_hash<long> {};
+    template <> struct hash<unsigned long> : public integral_hash<unsigned long> {};
+
+    template <typename T>
+    struct hash<T *>
+    {
+        typedef T *argument_type;
+        typedef std::size_t result_type;
+
+        std::size_t operator()(T *ptr) const
+        {
+            return hash_mix(reinterpret_cast<std::size_t>(ptr));
+        }
+    };
+
+    template <>
+    struct hash<std::string>
+    {
+        typedef std::string argument_type;
+        typedef std::size_t result_type;
+
+        std::size_t operator()(const std::string &str) const
+        {
+            return hash_mix(hash_bytes(str.data(), str.size()));
+        }
+    };
+
+    // Transparent string hash: finds keys of type std::string from a `const char *` without a temporary
+    struct string_hash
+    {
+        typedef void is_transparent;
+
+        std::size_t operator()(const std::string &str) const
+        {
+            return hash_mix(hash_bytes(str.data(), str.size()));
+        }
+
+        std::size_t operator()(const char *str) const
+        {
+            std::size_t len = 0;
+            while (str[len] != '\0')
+                ++len;
+            return hash_mix(hash_bytes(str, len));
+        }
+    };
+
+    // Transparent equality, the counterpart of string_hash
+    struct transparent_equal_to
+    {
+        typedef void is_transparent;
+
+        template <typename T, typename U>
+        bool operator()(const T &lhs, const U &rhs) const
+        {
+            return lhs == rhs;
+        }
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
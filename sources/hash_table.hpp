@@ -0,0 +1,676 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_table.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:30:26 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 11:30:26 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_TABLE_HPP
+# define HASH_TABLE_HPP
+
+# include <algorithm>
+# include <cstddef>
+# include <iterator>
+# include <limits>
+# include <stdexcept>
+
+# if defined(__SSE2__)
+#  include <emmintrin.h>
+# endif
+
+# include "allocator_traits.hpp"
+# include "type_trait.hpp"
+# include "utility.hpp"
+
+/**
+ * @brief Flat open-addressing hash table in the style of Swiss tables. Elements live directly in one
+ * array of slots; a parallel array holds one control byte per slot: 0x80 when the slot is empty,
+ * otherwise the low 7 bits of the element's hash (h2). A lookup loads 16 control bytes at once and
+ * compares them all against h2 with SSE2, so most misses and hits touch a single control group
+ * and at most one or two slots.
+ *
+ * Probing is linear, one slot at a time (groups are loaded unaligned), which keeps the invariant
+ * "no empty slot between an element and its home slot". Erase relies on it: instead of leaving
+ * tombstones, it shifts the following elements of the run back (backward-shift deletion), so the
+ * table never degrades under insert/erase churn.
+ *
+ * Erase moves elements, so it invalidates every iterator, not only the erased one.
+ *
+ * @link https://abseil.io/about/design/swisstables @endlink
+ * @link https://en.wikipedia.org/wiki/Linear_probing#Deletion @endlink
+ */
+
+namespace ft
+{
+    // Key extractors, the same table serves maps and sets
+    template <typename Pair>
+    struct select_first
+    {
+        typedef typename Pair::first_type key_type;
+
+        const key_type &operator()(const Pair &value) const
+        {
+            return value.first;
+        }
+    };
+
+    template <typename T>
+    struct identity
+    {
+        typedef T key_type;
+
+        const T &operator()(const T &value) const
+        {
+            return value;
+        }
+    };
+
+    // One SSE2 register worth of control bytes
+    struct hash_group
+    {
+        enum constants
+        {
+            width = 16,
+            empty = 0x80
+        };
+
+        // Bit i set when ctrl[i] == h2
+        static unsigned int match(const unsigned char *ctrl, unsigned char h2)
+        {
+# if defined(__SSE2__)
+            __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+            return static_cast<unsigned int>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(h2)))));
+# else
+            unsigned int mask = 0;
+            for (std::size_t i = 0; i < width; ++i)
+                if (ctrl[i] == h2)
+                    mask |= 1u << i;
+            return mask;
+# endif
+        }
+
+        // Bit i set when ctrl[i] is empty (high bit set)
+        static unsigned int match_empty(const unsigned char *ctrl)
+        {
+# if defined(__SSE2__)
+            __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+            return static_cast<unsigned int>(_mm_movemask_epi8(group));
+# else
+            unsigned int mask = 0;
+            for (std::size_t i = 0; i < width; ++i)
+                if (ctrl[i] & empty)
+                    mask |= 1u << i;
+            return mask;
+# endif
+        }
+
+        static unsigned int lowest_bit(unsigned int mask)
+        {
+            return static_cast<unsigned int>(__builtin_ctz(mask));
+        }
+    };
+
+    template <typename Value, typename Ref, typename Ptr>
+    class hash_table_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Value value_type;
+        typedef Ref reference;
+        typedef Ptr pointer;
+        typedef std::ptrdiff_t difference_type;
+        typedef hash_table_iterator<Value, Value &, Value *> non_const_iterator;
+
+    public:
+        hash_table_iterator()
+            : ctrl_(NULL), slot_(NULL), ctrl_end_(NULL)
+        {
+        }
+
+        hash_table_iterator(const unsigned char *ctrl, Value *slot, const unsigned char *ctrl_end)
+            : ctrl_(ctrl), slot_(slot), ctrl_end_(ctrl_end)
+        {
+        }
+
+        hash_table_iterator(const non_const_iterator &it)
+            : ctrl_(it.ctrl()), slot_(it.slot()), ctrl_end_(it.ctrl_end())
+        {
+        }
+
+    public:
+        reference operator*() const
+        {
+            return *slot_;
+        }
+
+        pointer operator->() const
+        {
+            return slot_;
+        }
+
+        hash_table_iterator &operator++()
+        {
+            ++ctrl_;
+            ++slot_;
+            skip_empty();
+            return *this;
+        }
+
+        hash_table_iterator operator++(int)
+        {
+            hash_table_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        template <typename R, typename P>
+        bool operator==(const hash_table_iterator<Value, R, P> &other) const
+        {
+            return slot_ == other.slot();
+        }
+
+        template <typename R, typename P>
+        bool operator!=(const hash_table_iterator<Value, R, P> &other) const
+        {
+            return !(*this == other);
+        }
+
+        const unsigned char *ctrl() const
+        {
+            return ctrl_;
+        }
+
+        Value *slot() const
+        {
+            return slot_;
+        }
+
+        const unsigned char *ctrl_end() const
+        {
+            return ctrl_end_;
+        }
+
+        // Moves forward to the first full slot (or the end)
+        void skip_empty()
+        {
+            while (ctrl_ != ctrl_end_ && (*ctrl_ & hash_group::empty))
+            {
+                ++ctrl_;
+                ++slot_;
+            }
+        }
+
+    private:
+        const unsigned char *ctrl_;
+        Value *slot_;
+        const unsigned char *ctrl_end_;
+    };
+
+    template <typename Value, typename KeyOfValue, typename Hash, typename KeyEqual,
+              typename Allocator>
+    class hash_table
+    {
+    public:
+        typedef typename KeyOfValue::key_type key_type;
+        typedef Value value_type;
+        typedef Hash hasher;
+        typedef KeyEqual key_equal;
+        typedef Allocator allocator_type;
+        typedef typename allocator_type::size_type size_type;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef value_type &reference;
+        typedef const value_type &const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef hash_table_iterator<value_type, value_type &, value_type *> iterator;
+        typedef hash_table_iterator<value_type, const value_type &, const value_type *> const_iterator;
+
+        static const bool transparent = has_is_transparent<Hash>::value
+                                        && has_is_transparent<KeyEqual>::value;
+
+    private:
+        typedef typename allocator_type::template rebind<unsigned char>::other ctrl_allocator;
+        typedef allocator_traits<allocator_type> alloc_traits;
+
+        static const size_type npos = static_cast<size_type>(-1);
+        static const size_type min_capacity = hash_group::width;
+
+    public:
+        explicit hash_table(size_type bucket_count = 0, const hasher &hash = hasher(),
+                            const key_equal &equal = key_equal(),
+                            const allocator_type &alloc = allocator_type())
+            : alloc_(alloc),
+              ctrl_alloc_(alloc),
+              hash_(hash),
+              equal_(equal),
+              ctrl_(NULL),
+              slots_(NULL),
+              capacity_(0),
+              size_(0),
+              max_load_(0.875f)
+        {
+            if (bucket_count != 0)
+                rehash(bucket_count);
+        }
+
+        hash_table(const hash_table &other)
+            : alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)),
+              ctrl_alloc_(alloc_),
+              hash_(other.hash_),
+              equal_(other.equal_),
+              ctrl_(NULL),
+              slots_(NULL),
+              capacity_(0),
+              size_(0),
+              max_load_(other.max_load_)
+        {
+            reserve(other.size());
+            insert(other.begin(), other.end());
+        }
+
+        hash_table(const hash_table &other, const allocator_type &alloc)
+            : alloc_(alloc),
+              ctrl_alloc_(alloc),
+              hash_(other.hash_),
+              equal_(other.equal_),
+              ctrl_(NULL),
+              slots_(NULL),
+              capacity_(0),
+              size_(0),
+              max_load_(other.max_load_)
+        {
+            reserve(other.size());
+            insert(other.begin(), other.end());
+        }
+
+        hash_table &operator=(const hash_table &other)
+        {
+            if (this != &other)
+            {
+                const bool propagate = alloc_traits::propagate_on_container_copy_assignment::value;
+                hash_table tmp(other, propagate ? other.alloc_ : alloc_);
+                swap_contents(tmp);
+                std::swap(alloc_, tmp.alloc_);
+                std::swap(ctrl_alloc_, tmp.ctrl_alloc_);
+            }
+            return *this;
+        }
+
+        ~hash_table()
+        {
+            destroy_all();
+            deallocate_storage(ctrl_, slots_, capacity_);
+        }
+
+    // Iterators and capacity
+    public:
+        iterator begin()
+        {
+            iterator it(ctrl_, slots_, ctrl_ + capacity_);
+            it.skip_empty();
+            return it;
+        }
+
+        const_iterator begin() const
+        {
+            const_iterator it(ctrl_, slots_, ctrl_ + capacity_);
+            it.skip_empty();
+            return it;
+        }
+
+        iterator end()
+        {
+            return iterator(ctrl_ + capacity_, slots_ + capacity_, ctrl_ + capacity_);
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(ctrl_ + capacity_, slots_ + capacity_, ctrl_ + capacity_);
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        size_type size() const
+        {
+            return size_;
+        }
+
+        size_type max_size() const
+        {
+            return std::min(alloc_.max_size(),
+                            static_cast<size_type>(std::numeric_limits<difference_type>::max()));
+        }
+
+        allocator_type get_allocator() const
+        {
+            return alloc_;
+        }
+
+        hasher hash_function() const
+        {
+            return hash_;
+        }
+
+        key_equal key_eq() const
+        {
+            return equal_;
+        }
+
+    // Hash policy
+    public:
+        size_type bucket_count() const
+        {
+            return capacity_;
+        }
+
+        float load_factor() const
+        {
+            return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(capacity_);
+        }
+
+        float max_load_factor() const
+        {
+            return max_load_;
+        }
+
+        // Clamped to [0.25, 0.95]: the probing needs at least one empty slot per run
+        void max_load_factor(float ml)
+        {
+            max_load_ = std::max(0.25f, std::min(ml, 0.95f));
+            reserve(size_);
+        }
+
+        // Enough buckets for `count` elements without going over max_load_factor()
+        void reserve(size_type count)
+        {
+            rehash(static_cast<size_type>(static_cast<float>(count) / max_load_) + 1);
+        }
+
+        void rehash(size_type count)
+        {
+            size_type needed = static_cast<size_type>(static_cast<float>(size_) / max_load_) + 1;
+            size_type cap = min_capacity;
+            while (cap < count || cap < needed)
+                cap *= 2;
+            if (cap != capacity_)
+                resize(cap);
+        }
+
+    // Modifiers
+    public:
+        void clear()
+        {
+            destroy_all();
+            if (ctrl_ != NULL)
+                std::fill(ctrl_, ctrl_ + capacity_ + hash_group::width,
+                          static_cast<unsigned char>(hash_group::empty));
+            size_ = 0;
+        }
+
+        pair<iterator, bool> insert(const value_type &value)
+        {
+            const key_type &key = key_of_(value);
+            size_type h = hash_(key);
+            size_type idx = find_index(key, h);
+            if (idx != npos)
+                return ft::make_pair(iterator_at(idx), false);
+
+            if (size_ + 1 > static_cast<size_type>(static_cast<float>(capacity_) * max_load_))
+                rehash(capacity_ == 0 ? size_type(min_capacity) : capacity_ * 2);
+            idx = place(value, h);
+            return ft::make_pair(iterator_at(idx), true);
+        }
+
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                insert(*first);
+        }
+
+        void erase(const_iterator pos)
+        {
+            erase_index(static_cast<size_type>(pos.slot() - slots_));
+        }
+
+        template <typename K>
+        size_type erase_key(const K &key)
+        {
+            size_type idx = find_index(key, hash_(key));
+            if (idx == npos)
+                return 0;
+            erase_index(idx);
+            return 1;
+        }
+
+        // Allocators are exchanged only when they propagate on swap, see allocator_traits
+        void swap(hash_table &other)
+        {
+            if (alloc_traits::propagate_on_container_swap::value)
+            {
+                std::swap(alloc_, other.alloc_);
+                std::swap(ctrl_alloc_, other.ctrl_alloc_);
+            }
+            swap_contents(other);
+        }
+
+    private:
+        void swap_contents(hash_table &other)
+        {
+            std::swap(hash_, other.hash_);
+            std::swap(equal_, other.equal_);
+            std::swap(ctrl_, other.ctrl_);
+            std::swap(slots_, other.slots_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(size_, other.size_);
+            std::swap(max_load_, other.max_load_);
+        }
+
+    // Lookup, K is key_type or, with transparent functors, anything they accept
+    public:
+        template <typename K>
+        iterator find(const K &key)
+        {
+            size_type idx = find_index(key, hash_(key));
+            return idx == npos ? end() : iterator_at(idx);
+        }
+
+        template <typename K>
+        const_iterator find(const K &key) const
+        {
+            size_type idx = find_index(key, hash_(key));
+            return idx == npos ? end() : const_iterator(iterator_at(idx));
+        }
+
+        template <typename K>
+        size_type count(const K &key) const
+        {
+            return find_index(key, hash_(key)) == npos ? 0 : 1;
+        }
+
+    private:
+        static size_type h1(size_type h)
+        {
+            return h >> 7;
+        }
+
+        static unsigned char h2(size_type h)
+        {
+            return static_cast<unsigned char>(h & 0x7f);
+        }
+
+        size_type mask() const
+        {
+            return capacity_ - 1;
+        }
+
+        iterator iterator_at(size_type idx) const
+        {
+            return iterator(ctrl_ + idx, slots_ + idx, ctrl_ + capacity_);
+        }
+
+        // Writes a control byte, mirroring the first group after the end for wrapped loads
+        void set_ctrl(size_type idx, unsigned char value)
+        {
+            ctrl_[idx] = value;
+            if (idx < hash_group::width)
+                ctrl_[capacity_ + idx] = value;
+        }
+
+        template <typename K>
+        size_type find_index(const K &key, size_type h) const
+        {
+            if (capacity_ == 0)
+                return npos;
+            size_type pos = h1(h) & mask();
+            const unsigned char tag = h2(h);
+            while (true)
+            {
+                const unsigned char *group = ctrl_ + pos;
+                for (unsigned int m = hash_group::match(group, tag); m != 0; m &= m - 1)
+                {
+                    size_type idx = (pos + hash_group::lowest_bit(m)) & mask();
+                    if (equal_(key_of_(slots_[idx]), key))
+                        return idx;
+                }
+                if (hash_group::match_empty(group) != 0)
+                    return npos;
+                pos = (pos + hash_group::width) & mask();
+            }
+        }
+
+        // First empty slot of the probe sequence, the table must not be full
+        size_type find_empty(size_type h) const
+        {
+            size_type pos = h1(h) & mask();
+            while (true)
+            {
+                unsigned int m = hash_group::match_empty(ctrl_ + pos);
+                if (m != 0)
+                    return (pos + hash_group::lowest_bit(m)) & mask();
+                pos = (pos + hash_group::width) & mask();
+            }
+        }
+
+        size_type place(const value_type &value, size_type h)
+        {
+            size_type idx = find_empty(h);
+            alloc_.construct(slots_ + idx, value);
+            set_ctrl(idx, h2(h));
+            ++size_;
+            return idx;
+        }
+
+        // Backward-shift deletion: pull the rest of the run back over the hole
+        void erase_index(size_type idx)
+        {
+            alloc_.destroy(slots_ + idx);
+            set_ctrl(idx, hash_group::empty);
+            --size_;
+
+            size_type hole = idx;
+            size_type j = (idx + 1) & mask();
+            while (!(ctrl_[j] & hash_group::empty))
+            {
+                size_type home = h1(hash_(key_of_(slots_[j]))) & mask();
+                if (((j - home) & mask()) >= ((j - hole) & mask()))
+                {
+                    alloc_.construct(slots_ + hole, slots_[j]);
+                    alloc_.destroy(slots_ + j);
+                    set_ctrl(hole, ctrl_[j]);
+                    set_ctrl(j, hash_group::empty);
+                    hole = j;
+                }
+                j = (j + 1) & mask();
+            }
+        }
+
+        // Strong guarantee: the table is only changed once both arrays exist and every element
+        // has been copied into them
+        void resize(size_type new_capacity)
+        {
+            unsigned char *new_ctrl = ctrl_alloc_.allocate(new_capacity + hash_group::width);
+            pointer new_slots;
+            try
+            {
+                new_slots = alloc_.allocate(new_capacity);
+            }
+            catch (...)
+            {
+                ctrl_alloc_.deallocate(new_ctrl, new_capacity + hash_group::width);
+                throw;
+            }
+            std::fill(new_ctrl, new_ctrl + new_capacity + hash_group::width,
+                      static_cast<unsigned char>(hash_group::empty));
+
+            unsigned char *old_ctrl = ctrl_;
+            pointer old_slots = slots_;
+            size_type old_capacity = capacity_;
+            size_type old_size = size_;
+
+            ctrl_ = new_ctrl;
+            slots_ = new_slots;
+            capacity_ = new_capacity;
+            size_ = 0;
+            try
+            {
+                for (size_type i = 0; i < old_capacity; ++i)
+                    if (!(old_ctrl[i] & hash_group::empty))
+                        place(old_slots[i], hash_(key_of_(old_slots[i])));
+            }
+            catch (...)
+            {
+                destroy_all();
+                deallocate_storage(ctrl_, slots_, capacity_);
+                ctrl_ = old_ctrl;
+                slots_ = old_slots;
+                capacity_ = old_capacity;
+                size_ = old_size;
+                throw;
+            }
+
+            for (size_type i = 0; i < old_capacity; ++i)
+                if (!(old_ctrl[i] & hash_group::empty))
+                    alloc_.destroy(old_slots + i);
+            deallocate_storage(old_ctrl, old_slots, old_capacity);
+        }
+
+        void destroy_all()
+        {
+            for (size_type i = 0; i < capacity_; ++i)
+                if (!(ctrl_[i] & hash_group::empty))
+                    alloc_.destroy(slots_ + i);
+        }
+
+        void deallocate_storage(unsigned char *ctrl, pointer slots, size_type capacity)
+        {
+            if (ctrl == NULL)
+                return;
+            ctrl_alloc_.deallocate(ctrl, capacity + hash_group::width);
+            alloc_.deallocate(slots, capacity);
+        }
+
+    private:
+        allocator_type alloc_;
+        ctrl_allocator ctrl_alloc_;
+        hasher hash_;
+        key_equal equal_;
+        KeyOfValue key_of_;
+        unsigned char *ctrl_;
+        pointer slots_;
+        size_type capacity_;
+        size_type size_;
+        float max_load_;
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
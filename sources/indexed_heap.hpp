@@ -0,0 +1,326 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   indexed_heap.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:46:19 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 13:46:19 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef INDEXED_HEAP_HPP
+# define INDEXED_HEAP_HPP
+
+# include <climits>
+# include <cstddef>
+# include <functional>
+# include <memory>
+# include <stdexcept>
+
+# include "vector.hpp"
+
+/**
+ * @brief Addressable d-ary max-heap: push returns a handle that stays valid until its element is
+ * popped, erased or cleared, and update(handle, value) and erase(handle) are O(log n). Meant
+ * for timers and Dijkstra-like searches that change priorities in place, where an ft::map would
+ * pay a node allocation and a rebalance for every change. Every node has Arity children, at
+ * least 2.
+ *
+ * Everything lives in three ft::vectors: the heap of {value, handle} entries (compared without
+ * any indirection), the heap position and generation of every slot, and the slots free for reuse.
+ * Moving an entry writes its new position back, so no operation searches for an element.
+ *
+ * A handle is a slot index in its low half and the slot's generation in its high half. Freeing a
+ * slot bumps its generation, so a handle kept after its element is gone never names the element
+ * a later push put in the same slot: contains() is false for it, erase() and update() ignore it
+ * and return false, get() throws std::out_of_range. Generations wrap after 2^32 reuses of one
+ * slot on 64-bit targets (2^16 on 32-bit ones).
+ *
+ * @link https://en.wikipedia.org/wiki/D-ary_heap @endlink
+ * @link https://algs4.cs.princeton.edu/24pq/IndexMaxPQ.java.html @endlink
+ */
+
+namespace ft
+{
+    template <typename T, typename Compare = std::less<T>, std::size_t Arity = 4,
+              typename Allocator = std::allocator<T> >
+    class indexed_heap
+    {
+    public:
+        typedef T                                   value_type;
+        typedef Compare                             value_compare;
+        typedef Allocator                           allocator_type;
+        typedef std::size_t                         size_type;
+        typedef std::size_t                         handle_type;
+
+        static const size_type npos = static_cast<size_type>(-1);
+
+    private:
+        // C++98 static assert: an array of negative size does not compile when Arity < 2
+        typedef char arity_must_be_at_least_2[Arity >= 2 ? 1 : -1];
+
+        struct entry
+        {
+            value_type value;
+            handle_type handle;
+
+            entry(const value_type &v, handle_type h) : value(v), handle(h)
+            {
+            }
+        };
+
+        // Heap index of the slot's element (npos when free) and the generation of its handles
+        struct slot
+        {
+            size_type position;
+            size_type generation;
+
+            slot() : position(npos), generation(0)
+            {
+            }
+        };
+
+        typedef typename allocator_type::template rebind<entry>::other      entry_allocator;
+        typedef typename allocator_type::template rebind<slot>::other       slot_allocator;
+        typedef typename allocator_type::template rebind<size_type>::other  index_allocator;
+
+        static const size_type slot_bits = sizeof(handle_type) * CHAR_BIT / 2;
+        static const size_type slot_mask = (handle_type(1) << slot_bits) - 1;
+
+    public:
+        explicit indexed_heap(const value_compare &compare = value_compare(),
+                              const allocator_type &alloc = allocator_type())
+            : comp_(compare), heap_(entry_allocator(alloc)), slots_(slot_allocator(alloc)),
+              free_(index_allocator(alloc))
+        {
+        }
+
+    public:
+        bool empty() const
+        {
+            return heap_.empty();
+        }
+
+        size_type size() const
+        {
+            return heap_.size();
+        }
+
+        const value_type &top() const
+        {
+            return heap_.front().value;
+        }
+
+        handle_type top_handle() const
+        {
+            return heap_.front().handle;
+        }
+
+        bool contains(handle_type handle) const
+        {
+            const size_type index = handle & slot_mask;
+            return index < slots_.size() && slots_[index].position != npos
+                && slots_[index].generation == handle >> slot_bits;
+        }
+
+        const value_type &get(handle_type handle) const
+        {
+            if (!contains(handle))
+                throw std::out_of_range("Stale ft::indexed_heap handle");
+            return heap_[slots_[handle & slot_mask].position].value;
+        }
+
+        handle_type push(const value_type &value)
+        {
+            const handle_type handle = acquire_handle();
+            try
+            {
+                heap_.push_back(entry(value, handle));
+            }
+            catch (...)
+            {
+                release_handle(handle);
+                throw;
+            }
+            sift_up(heap_.size() - 1, heap_.back());
+            return handle;
+        }
+
+        void pop()
+        {
+            erase_at(0);
+        }
+
+        // Removes handle's element; false, doing nothing, when handle names no element
+        bool erase(handle_type handle)
+        {
+            if (!contains(handle))
+                return false;
+            erase_at(slots_[handle & slot_mask].position);
+            return true;
+        }
+
+        // Changes the value of handle's element, moving it up or down to its new place; false,
+        // doing nothing, when handle names no element
+        bool update(handle_type handle, const value_type &value)
+        {
+            if (!contains(handle))
+                return false;
+            const size_type i = slots_[handle & slot_mask].position;
+            const entry moved(value, handle);
+            if (comp_(heap_[i].value, value))
+                sift_up(i, moved);
+            else
+                sift_down(i, moved);
+            return true;
+        }
+
+        // Frees every slot like erase would, so handles taken before clear() stay stale after it
+        void clear()
+        {
+            free_.reserve(free_.size() + heap_.size());
+            for (size_type i = 0; i < heap_.size(); ++i)
+                release_handle(heap_[i].handle);
+            heap_.clear();
+        }
+
+        void reserve(size_type count)
+        {
+            heap_.reserve(count);
+            slots_.reserve(count);
+        }
+
+        void swap(indexed_heap &other)
+        {
+            std::swap(comp_, other.comp_);
+            heap_.swap(other.heap_);
+            slots_.swap(other.slots_);
+            free_.swap(other.free_);
+        }
+
+        allocator_type get_allocator() const
+        {
+            return allocator_type(heap_.get_allocator());
+        }
+
+    private:
+        handle_type acquire_handle()
+        {
+            size_type index;
+            if (!free_.empty())
+            {
+                index = free_.back();
+                free_.pop_back();
+            }
+            else
+            {
+                if (slots_.size() > slot_mask)
+                    throw std::length_error("ft::indexed_heap out of handles");
+                slots_.push_back(slot());
+                index = slots_.size() - 1;
+            }
+            return slots_[index].generation << slot_bits | index;
+        }
+
+        // The next handle of the slot gets a new generation, so this one goes stale
+        void release_handle(handle_type handle)
+        {
+            slot &freed = slots_[handle & slot_mask];
+            freed.position = npos;
+            freed.generation = (freed.generation + 1) & slot_mask;
+            free_.push_back(handle & slot_mask);
+        }
+
+        // The last entry fills the hole at i and moves to its place
+        void erase_at(size_type i)
+        {
+            const handle_type handle = heap_[i].handle;
+            free_.reserve(free_.size() + 1);
+            if (i + 1 < heap_.size())
+            {
+                const entry last = heap_.back();
+                heap_.pop_back();
+                if (i > 0 && comp_(heap_[(i - 1) / Arity].value, last.value))
+                    sift_up(i, last);
+                else
+                    sift_down(i, last);
+            }
+            else
+                heap_.pop_back();
+            release_handle(handle);
+        }
+
+        void place(size_type i, const entry &e)
+        {
+            heap_[i] = e;
+            slots_[e.handle & slot_mask].position = i;
+        }
+
+        // Puts e in the hole at i and moves it up to its place
+        void sift_up(size_type i, const entry &e)
+        {
+            const entry moved = e;
+            while (i > 0)
+            {
+                const size_type parent = (i - 1) / Arity;
+                if (!comp_(heap_[parent].value, moved.value))
+                    break;
+                place(i, heap_[parent]);
+                i = parent;
+            }
+            place(i, moved);
+        }
+
+        // Puts e in the hole at i and moves it down to its place
+        void sift_down(size_type i, const entry &e)
+        {
+            const entry moved = e;
+            const size_type n = heap_.size();
+            while (true)
+            {
+                const size_type first_child = i * Arity + 1;
+                if (first_child >= n)
+                    break;
+                const size_type last_child = first_child + Arity < n ? first_child + Arity : n;
+                size_type best = first_child;
+                for (size_type child = first_child + 1; child < last_child; ++child)
+                    if (comp_(heap_[best].value, heap_[child].value))
+                        best = child;
+                if (!comp_(moved.value, heap_[best].value))
+                    break;
+                place(i, heap_[best]);
+                i = best;
+            }
+            place(i, moved);
+        }
+
+    private:
+        value_compare comp_;
+        vector<entry, entry_allocator> heap_;
+        vector<slot, slot_allocator> slots_;
+        vector<size_type, index_allocator> free_; // Indices of the free slots
+    };
+
+    template <typename T, typename Compare, std::size_t Arity, typename Allocator>
+    const typename indexed_heap<T, Compare, Arity, Allocator>::size_type
+        indexed_heap<T, Compare, Arity, Allocator>::npos;
+
+    template <typename T, typename Compare, std::size_t Arity, typename Allocator>
+    const typename indexed_heap<T, Compare, Arity, Allocator>::size_type
+        indexed_heap<T, Compare, Arity, Allocator>::slot_bits;
+
+    template <typename T, typename Compare, std::size_t Arity, typename Allocator>
+    const typename indexed_heap<T, Compare, Arity, Allocator>::size_type
+        indexed_heap<T, Compare, Arity, Allocator>::slot_mask;
+
+    template <typename T, typename Compare, std::size_t Arity, typename Allocator>
+    inline void swap(indexed_heap<T, Compare, Arity, Allocator> &lhs,
+                     indexed_heap<T, Compare, Arity, Allocator> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -134,9 +134,13 @@ namespace ft
             return *--tmp;
         }
 
+        // Goes through It's own operator-> so that iterators whose reference is a proxy object
+        // (flat_map, static_map) work: the address of the proxy would be that of a temporary
         pointer operator->() const
         {
-            return &(operator*());
+            It tmp = _current;
+            --tmp;
+            return arrow(tmp);
         }
 
         reference operator[](difference_type n) const
@@ -191,6 +195,19 @@ namespace ft
             _current += n;
             return *this;
         }
+
+    private:
+        template <typename T>
+        static T *arrow(T *it)
+        {
+            return it;
+        }
+
+        template <typename Iter>
+        static pointer arrow(Iter &it)
+        {
+            return it.operator->();
+        }
     }; // End of reverse_iterator class
 
     /**
@@ -15,7 +15,9 @@
 
 # include <memory>
 
+# include "bloom_filter.hpp"
 # include "iterator.hpp"
+# include "polymorphic_allocator.hpp"
 # include "tree.hpp"
 
 /**
@@ -26,6 +28,10 @@
  * 
  * @link https://www.geeksforgeeks.org/map-associative-containers-the-c-standard-template-library-stl/ @endlink
  * @link https://cplusplus.com/reference/map/map/ @endlink
+ *
+ * The tree is red-black by default; the Balance parameter selects another policy of
+ * tree_balance.hpp (avl_balance, treap_balance, splay_balance).
+ *
  * @link https://en.cppreference.com/w/cpp/container/map @endlink
  */
 
@@ -87,7 +93,8 @@ namespace ft
     }
 
     template <typename Key, typename T, typename Compare = std::less<Key>,
-              typename Allocator = std::allocator<pair<const Key, T> > >
+              typename Allocator = std::allocator<pair<const Key, T> >,
+              typename Balance = rb_balance>
     class map
     {
     public:
@@ -105,7 +112,7 @@ namespace ft
 
 private:
     typedef map_value_type_compare<key_type, value_type, key_compare> vt_compare;
-    typedef tree<value_type, vt_compare, allocator_type>              base;
+    typedef tree<value_type, vt_compare, allocator_type, Balance>     base;
 
 public:
     typedef typename base::iterator              iterator;
@@ -141,36 +148,51 @@ public:
 
     public:
         map()
-            : tree_(vt_compare())
+            : tree_(vt_compare()), filter_(NULL)
         {
         }
 
         explicit map(const key_compare &comp, const allocator_type &alloc = allocator_type())
-            : tree_(vt_compare(comp), alloc)
+            : tree_(vt_compare(comp), alloc), filter_(NULL)
         {
         }
 
         template <typename InputIt>
         map(InputIt first, InputIt last, const key_compare &comp = key_compare(),
             const allocator_type &alloc = allocator_type())
-            : tree_(vt_compare(comp), alloc)
+            : tree_(vt_compare(comp), alloc), filter_(NULL)
         {
             insert(first, last);
         }
 
         map(const map &other)
-            : tree_(other.tree_)
+            : tree_(other.tree_), filter_(other.filter_ == NULL ? NULL : other.filter_->clone())
         {
         }
 
         map &operator=(const map &other)
         {
-            tree_ = other.tree_;
+            if (this == &other)
+                return *this;
+
+            key_filter<key_type> *filter = other.filter_ == NULL ? NULL : other.filter_->clone();
+            try
+            {
+                tree_ = other.tree_;
+            }
+            catch (...)
+            {
+                delete filter;
+                throw;
+            }
+            delete filter_;
+            filter_ = filter;
             return *this;
         }
 
         ~map()
         {
+            delete filter_;
         }
 
     public:
@@ -258,59 +280,263 @@ public:
         void clear()
         {
             tree_.clear();
+            if (filter_ != NULL)
+                filter_->clear();
         }
 
         pair<iterator, bool> insert(const value_type &value)
         {
-            return tree_.insert(value);
+            pair<iterator, bool> result = tree_.insert(value);
+            if (result.second)
+                filter_add(value.first);
+            return result;
         }
 
         iterator insert(iterator hint, const value_type &value)
         {
-            return tree_.insert(hint, value);
+            const size_type old_size = size();
+            iterator it = tree_.insert(hint, value);
+            if (size() != old_size)
+                filter_add(value.first);
+            return it;
         }
 
         template <typename InputIt>
         void insert(InputIt first, InputIt last)
         {
-            tree_.insert(first, last);
+            if (filter_ == NULL)
+            {
+                tree_.insert(first, last);
+                return;
+            }
+            for (; first != last; ++first)
+                insert(*first);
         }
 
         void erase(iterator pos)
         {
+            if (filter_ != NULL)
+                filter_->remove(pos->first);
             tree_.erase(const_iterator(pos));
         }
 
         void erase(iterator first, iterator last)
         {
+            if (filter_ != NULL)
+            {
+                for (iterator it = first; it != last; ++it)
+                    filter_->remove(it->first);
+            }
             tree_.erase(first, last);
         }
 
         size_type erase(const key_type &key)
         {
-            return tree_.erase(key);
+            size_type erased = tree_.erase(key);
+            if (erased != 0 && filter_ != NULL)
+                filter_->remove(key);
+            return erased;
         }
 
         void swap(map &other)
         {
             tree_.swap(other.tree_);
+            std::swap(filter_, other.filter_);
+        }
+
+        /**
+         * @brief Maps with Balance = treap_balance only, see tree::split and tree::join. split
+         * moves the keys not less than key into greater (emptied first), join moves all of
+         * greater's elements in. With a Bloom filter, the moved keys are added to the receiving
+         * map's filter; the giving map's filter keeps them, which only costs false positives.
+         */
+        void split(const key_type &key, map &greater)
+        {
+            if (&greater == this)
+                return;
+            greater.clear();
+            tree_.split(key, greater.tree_);
+            if (greater.filter_ != NULL)
+                for (const_iterator it = greater.begin(); it != greater.end(); ++it)
+                    greater.filter_add(it->first);
+        }
+
+        void join(map &greater)
+        {
+            if (&greater == this)
+                return;
+            if (filter_ != NULL && size() + greater.size() <= filter_->capacity())
+                for (const_iterator it = greater.begin(); it != greater.end(); ++it)
+                    filter_->add(it->first);
+            const bool refill = filter_ != NULL && size() + greater.size() > filter_->capacity();
+            tree_.join(greater.tree_);
+            if (greater.filter_ != NULL)
+                greater.filter_->clear();
+            if (refill)
+                refill_filter();
         }
 
         size_type count(const key_type &key) const
         {
-            return tree_.count(key);
+            return find(key) == end() ? size_type(0) : size_type(1);
+        }
+
+        bool contains(const key_type &key) const
+        {
+            return find(key) != end();
         }
 
         iterator find(const key_type &key)
         {
-            return tree_.find(key);
+            if (filter_ != NULL && !filter_->query(key))
+                return end();
+            iterator it = tree_.find(key);
+            if (filter_ != NULL && it == end())
+                filter_->record_false_positive();
+            return it;
         }
 
         const_iterator find(const key_type &key) const
         {
-            return tree_.find(key);
+            if (filter_ != NULL && !filter_->query(key))
+                return end();
+            const_iterator it = tree_.find(key);
+            if (filter_ != NULL && it == end())
+                filter_->record_false_positive();
+            return it;
+        }
+
+        // Finds many keys at once, see tree::find_batch. Writes one iterator per key to out.
+        template <typename ForwardIt, typename OutputIt>
+        OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+        {
+            return tree_.find_batch(first, last, out);
+        }
+
+        template <typename ForwardIt, typename OutputIt>
+        OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+        {
+            return tree_.find_batch(first, last, out);
+        }
+
+        // Finger search: starts from a previously found iterator, cheap when keys are close
+        iterator find(const_iterator finger, const key_type &key)
+        {
+            return tree_.find(finger, key);
+        }
+
+        const_iterator find(const_iterator finger, const key_type &key) const
+        {
+            return tree_.find(finger, key);
+        }
+
+        iterator lower_bound(const_iterator finger, const key_type &key)
+        {
+            return tree_.lower_bound(finger, key);
+        }
+
+        const_iterator lower_bound(const_iterator finger, const key_type &key) const
+        {
+            return tree_.lower_bound(finger, key);
+        }
+
+        // Moves every node into one contiguous block, see tree::compact
+        void compact(tree_layout layout = tree_layout_bfs)
+        {
+            tree_.compact(layout);
+        }
+
+        void freeze()
+        {
+            tree_.freeze();
+        }
+
+        // Opt-in last-hit cache for repeated-key lookups (find, count, operator[], insert)
+        void enable_lookup_cache(bool enabled = true)
+        {
+            tree_.enable_lookup_cache(enabled);
+        }
+
+        bool lookup_cache_enabled() const
+        {
+            return tree_.lookup_cache_enabled();
+        }
+
+        const tree_cache_stats &lookup_cache_stats() const
+        {
+            return tree_.lookup_cache_stats();
+        }
+
+        void reset_lookup_cache_stats()
+        {
+            tree_.reset_lookup_cache_stats();
         }
 
+        /**
+         * @brief Opt-in counting Bloom filter in front of find, count, contains and at: lookups of
+         * absent keys are mostly answered without descending the tree. Costs counters_per_key
+         * 4-bit counters per element and one filter update per insert and erase; the filter
+         * doubles (rebuilt from the map) when the map outgrows it. Requires ft::hash<key_type>,
+         * or pass the hash function object to use. The filter's stats are relaxed atomics, so
+         * const lookups may still run on several threads at once.
+         */
+        void enable_bloom_filter(size_type counters_per_key = 8)
+        {
+            enable_bloom_filter(counters_per_key, hash<key_type>());
+        }
+
+        template <typename Hash>
+        void enable_bloom_filter(size_type counters_per_key, const Hash &hash)
+        {
+            key_filter<key_type> *filter = new counting_bloom_filter<key_type, Hash>(counters_per_key, 0, hash);
+            try
+            {
+                fill_filter(*filter);
+            }
+            catch (...)
+            {
+                delete filter;
+                throw;
+            }
+            delete filter_;
+            filter_ = filter;
+        }
+
+        void disable_bloom_filter()
+        {
+            delete filter_;
+            filter_ = NULL;
+        }
+
+        bool bloom_filter_enabled() const
+        {
+            return filter_ != NULL;
+        }
+
+        bloom_filter_stats filter_stats() const
+        {
+            return filter_ == NULL ? bloom_filter_stats() : filter_->stats();
+        }
+
+        void reset_filter_stats()
+        {
+            if (filter_ != NULL)
+                filter_->reset_stats();
+        }
+
+#ifdef FT_TREE_STATS
+        // Instrumentation counters, only in builds with FT_TREE_STATS defined
+        tree_stats stats() const
+        {
+            return tree_.stats();
+        }
+
+        void reset_stats()
+        {
+            tree_.reset_stats();
+        }
+#endif
+
         pair<iterator, iterator> equal_range(const key_type &key)
         {
             return tree_.equal_range(key);
@@ -352,56 +578,120 @@ public:
         }
 
     private:
+        void filter_add(const key_type &key)
+        {
+            if (filter_ == NULL)
+                return;
+            if (size() <= filter_->capacity())
+            {
+                filter_->add(key);
+                return;
+            }
+            refill_filter();
+        }
+
+        // A filter missing a key would hide it: without memory to rebuild, drop the filter
+        void refill_filter()
+        {
+            try
+            {
+                fill_filter(*filter_);
+                filter_->record_rebuild();
+            }
+            catch (...)
+            {
+                disable_bloom_filter();
+            }
+        }
+
+        // Sizes filter for twice the current elements and adds them all
+        void fill_filter(key_filter<key_type> &filter) const
+        {
+            filter.reset(2 * size());
+            for (const_iterator it = begin(); it != end(); ++it)
+                filter.add(it->first);
+        }
+
+        // tree::assign_sorted with the strong guarantee, keeping the lookup cache and Bloom filter
+        // settings; reached through tree_access by the snapshot loader
+        template <typename ForwardIt>
+        void replace_sorted(ForwardIt first, ForwardIt last)
+        {
+            map tmp(key_comp(), get_allocator());
+            tmp.tree_.assign_sorted(first, last);
+            tmp.enable_lookup_cache(lookup_cache_enabled());
+            if (filter_ != NULL)
+            {
+                tmp.filter_ = filter_->clone();
+                tmp.fill_filter(*tmp.filter_);
+            }
+            swap(tmp);
+        }
+
+    private:
+        friend struct tree_access;
+
         base tree_;
+        key_filter<key_type> *filter_; // Optional Bloom filter, see enable_bloom_filter
     }; // end of map
 
-    template <typename Key, typename T, typename Compare, typename Allocator>
-    inline void swap(map<Key, T, Compare, Allocator> &x, map<Key, T, Compare, Allocator> &y)
+    template <typename Key, typename T, typename Compare, typename Allocator, typename Balance>
+    inline void swap(map<Key, T, Compare, Allocator, Balance> &x, map<Key, T, Compare, Allocator, Balance> &y)
     {
         x.swap(y);
     }
 
-    template <typename Key, typename T, typename Compare, typename Allocator>
-    inline bool operator==(const map<Key, T, Compare, Allocator> &lhs,
-                           const map<Key, T, Compare, Allocator> &rhs)
+    template <typename Key, typename T, typename Compare, typename Allocator, typename Balance>
+    inline bool operator==(const map<Key, T, Compare, Allocator, Balance> &lhs,
+                           const map<Key, T, Compare, Allocator, Balance> &rhs)
     {
         return (lhs.size() == rhs.size()) && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
     }
 
-    template <typename Key, typename T, typename Compare, typename Allocator>
-    inline bool operator!=(const map<Key, T, Compare, Allocator> &lhs,
-                           const map<Key, T, Compare, Allocator> &rhs)
+    template <typename Key, typename T, typename Compare, typename Allocator, typename Balance>
+    inline bool operator!=(const map<Key, T, Compare, Allocator, Balance> &lhs,
+                           const map<Key, T, Compare, Allocator, Balance> &rhs)
     {
         return !(lhs == rhs);
     }
 
-    template <typename Key, typename T, typename Compare, typename Allocator>
-    inline bool operator<(const map<Key, T, Compare, Allocator> &lhs,
-                          const map<Key, T, Compare, Allocator> &rhs)
+    template <typename Key, typename T, typename Compare, typename Allocator, typename Balance>
+    inline bool operator<(const map<Key, T, Compare, Allocator, Balance> &lhs,
+                          const map<Key, T, Compare, Allocator, Balance> &rhs)
     {
         return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
-    template <typename Key, typename T, typename Compare, typename Allocator>
-    inline bool operator<=(const map<Key, T, Compare, Allocator> &lhs,
-                           const map<Key, T, Compare, Allocator> &rhs)
+    template <typename Key, typename T, typename Compare, typename Allocator, typename Balance>
+    inline bool operator<=(const map<Key, T, Compare, Allocator, Balance> &lhs,
+                           const map<Key, T, Compare, Allocator, Balance> &rhs)
     {
         return !(rhs < lhs);
     }
 
-    template <typename Key, typename T, typename Compare, typename Allocator>
-    inline bool operator>(const map<Key, T, Compare, Allocator> &lhs,
-                          const map<Key, T, Compare, Allocator> &rhs)
+    template <typename Key, typename T, typename Compare, typename Allocator, typename Balance>
+    inline bool operator>(const map<Key, T, Compare, Allocator, Balance> &lhs,
+                          const map<Key, T, Compare, Allocator, Balance> &rhs)
     {
         return rhs < lhs;
     }
 
-    template <typename Key, typename T, typename Compare, typename Allocator>
-    inline bool operator>=(const map<Key, T, Compare, Allocator> &lhs,
-                           const map<Key, T, Compare, Allocator> &rhs)
+    template <typename Key, typename T, typename Compare, typename Allocator, typename Balance>
+    inline bool operator>=(const map<Key, T, Compare, Allocator, Balance> &lhs,
+                           const map<Key, T, Compare, Allocator, Balance> &rhs)
     {
         return !(lhs < rhs);
     }
+
+    namespace pmr
+    {
+        // ft::map allocating from a memory_resource
+        template <typename Key, typename T, typename Compare = std::less<Key>, typename Balance = rb_balance>
+        struct map
+        {
+            typedef ft::map<Key, T, Compare, polymorphic_allocator<pair<const Key, T> >, Balance> type;
+        };
+    } // namespace pmr
 } // namespace ft
 
 #endif
\ No newline at end of file
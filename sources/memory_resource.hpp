@@ -0,0 +1,469 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memory_resource.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:47:21 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 10:47:21 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MEMORY_RESOURCE_HPP
+# define MEMORY_RESOURCE_HPP
+
+# include <algorithm>
+# include <cstddef>
+
+# include "mutex.hpp"
+# include "polymorphic_allocator.hpp"
+
+/**
+ * @brief The arena resources of C++17 <memory_resource>:
+ *
+ *  - monotonic_buffer_resource: bump allocation from a caller buffer, then from upstream chunks
+ *    growing geometrically. deallocate does nothing; release() or the destructor returns
+ *    everything at once. Containers on it skip the per-element walk on destruction when their
+ *    elements are trivially destructible. The request-scoped arena.
+ *  - unsynchronized_pool_resource: one free list per power-of-two block size up to
+ *    largest_required_pool_block, refilled with chunks of up to max_blocks_per_chunk blocks.
+ *    Larger or over-aligned requests go straight upstream. Single-threaded.
+ *  - synchronized_pool_resource: the same behind a mutex.
+ *
+ * @link https://en.cppreference.com/w/cpp/memory/monotonic_buffer_resource @endlink
+ * @link https://en.cppreference.com/w/cpp/memory/unsynchronized_pool_resource @endlink
+ */
+
+namespace ft
+{
+    namespace pmr
+    {
+        // Rounds size up to a multiple of alignment, a power of two
+        inline std::size_t align_up(std::size_t size, std::size_t alignment)
+        {
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        class monotonic_buffer_resource : public memory_resource
+        {
+        public:
+            explicit monotonic_buffer_resource(memory_resource *upstream = get_default_resource())
+                : upstream_(upstream), buffer_(NULL), buffer_size_(0), first_chunk_(default_chunk),
+                  next_chunk_(default_chunk), current_(NULL), space_(0), chunks_(NULL)
+            {
+            }
+
+            explicit monotonic_buffer_resource(std::size_t initial_size,
+                                               memory_resource *upstream = get_default_resource())
+                : upstream_(upstream), buffer_(NULL), buffer_size_(0),
+                  first_chunk_(std::max(initial_size, std::size_t(header_size * 2))),
+                  next_chunk_(first_chunk_), current_(NULL), space_(0), chunks_(NULL)
+            {
+            }
+
+            monotonic_buffer_resource(void *buffer, std::size_t size,
+                                      memory_resource *upstream = get_default_resource())
+                : upstream_(upstream), buffer_(static_cast<char *>(buffer)), buffer_size_(size),
+                  first_chunk_(std::max(size * 2, std::size_t(default_chunk))),
+                  next_chunk_(first_chunk_), current_(buffer_), space_(size), chunks_(NULL)
+            {
+            }
+
+            ~monotonic_buffer_resource()
+            {
+                release();
+            }
+
+        private:
+            monotonic_buffer_resource(const monotonic_buffer_resource &);
+            monotonic_buffer_resource &operator=(const monotonic_buffer_resource &);
+
+        public:
+            // Returns every chunk upstream; the initial buffer is reused from its start
+            void release()
+            {
+                while (chunks_ != NULL)
+                {
+                    chunk *next = chunks_->next;
+                    upstream_->deallocate(chunks_, chunks_->size, max_align);
+                    chunks_ = next;
+                }
+                current_ = buffer_;
+                space_ = buffer_size_;
+                next_chunk_ = first_chunk_;
+            }
+
+            memory_resource *upstream_resource() const
+            {
+                return upstream_;
+            }
+
+        protected:
+            void *do_allocate(std::size_t bytes, std::size_t alignment)
+            {
+                void *ptr = bump(bytes, alignment);
+                if (ptr != NULL)
+                    return ptr;
+                grow(bytes, alignment);
+                return bump(bytes, alignment);
+            }
+
+            void do_deallocate(void *, std::size_t, std::size_t)
+            {
+            }
+
+            bool do_is_equal(const memory_resource &other) const
+            {
+                return this == &other;
+            }
+
+            bool do_deallocation_is_noop() const
+            {
+                return true;
+            }
+
+        private:
+            struct chunk
+            {
+                chunk *next;
+                std::size_t size;
+            };
+
+            static const std::size_t header_size = (sizeof(chunk) + max_align - 1) & ~(max_align - 1);
+            static const std::size_t default_chunk = 1024;
+
+            void *bump(std::size_t bytes, std::size_t alignment)
+            {
+                if (current_ == NULL)
+                    return NULL;
+                const std::size_t address = reinterpret_cast<std::size_t>(current_);
+                const std::size_t padding = align_up(address, alignment) - address;
+                if (padding > space_ || bytes > space_ - padding)
+                    return NULL;
+                char *ptr = current_ + padding;
+                current_ = ptr + bytes;
+                space_ -= padding + bytes;
+                return ptr;
+            }
+
+            // Each chunk is at least twice the previous one, and large enough for the request
+            void grow(std::size_t bytes, std::size_t alignment)
+            {
+                const std::size_t needed = header_size + bytes + (alignment > max_align ? alignment : 0);
+                const std::size_t size = std::max(next_chunk_, needed);
+                chunk *fresh = static_cast<chunk *>(upstream_->allocate(size, max_align));
+                fresh->next = chunks_;
+                fresh->size = size;
+                chunks_ = fresh;
+                current_ = reinterpret_cast<char *>(fresh) + header_size;
+                space_ = size - header_size;
+                next_chunk_ = size * 2;
+            }
+
+        private:
+            memory_resource *upstream_;
+            char *buffer_;
+            std::size_t buffer_size_;
+            std::size_t first_chunk_;
+            std::size_t next_chunk_;
+            char *current_;
+            std::size_t space_;
+            chunk *chunks_;
+        };
+
+        struct pool_options
+        {
+            std::size_t max_blocks_per_chunk;        // 0 picks the default
+            std::size_t largest_required_pool_block; // 0 picks the default
+
+            pool_options()
+                : max_blocks_per_chunk(0), largest_required_pool_block(0)
+            {
+            }
+        };
+
+        class unsynchronized_pool_resource : public memory_resource
+        {
+        public:
+            explicit unsynchronized_pool_resource(const pool_options &options = pool_options(),
+                                                  memory_resource *upstream = get_default_resource())
+                : upstream_(upstream), options_(normalize(options)), pool_count_(0), large_(NULL)
+            {
+                init_pools();
+            }
+
+            explicit unsynchronized_pool_resource(memory_resource *upstream)
+                : upstream_(upstream), options_(normalize(pool_options())), pool_count_(0), large_(NULL)
+            {
+                init_pools();
+            }
+
+            ~unsynchronized_pool_resource()
+            {
+                release();
+            }
+
+        private:
+            unsynchronized_pool_resource(const unsynchronized_pool_resource &);
+            unsynchronized_pool_resource &operator=(const unsynchronized_pool_resource &);
+
+        public:
+            // Returns every chunk and large block upstream, even those still in use
+            void release()
+            {
+                for (std::size_t i = 0; i < pool_count_; ++i)
+                {
+                    pool &p = pools_[i];
+                    while (p.chunks != NULL)
+                    {
+                        chunk *next = p.chunks->next;
+                        upstream_->deallocate(p.chunks, p.chunks->size, max_align);
+                        p.chunks = next;
+                    }
+                    p.free = NULL;
+                    p.next_blocks = std::min(std::size_t(first_blocks), options_.max_blocks_per_chunk);
+                }
+                while (large_ != NULL)
+                {
+                    large_block *next = large_->next;
+                    upstream_->deallocate(large_, large_->size, large_->alignment);
+                    large_ = next;
+                }
+            }
+
+            memory_resource *upstream_resource() const
+            {
+                return upstream_;
+            }
+
+            pool_options options() const
+            {
+                return options_;
+            }
+
+        protected:
+            void *do_allocate(std::size_t bytes, std::size_t alignment)
+            {
+                const std::size_t index = pool_index(bytes, alignment);
+                if (index == pool_count_)
+                    return allocate_large(bytes, alignment);
+
+                pool &p = pools_[index];
+                if (p.free == NULL)
+                    refill(p, min_block << index);
+                free_block *block = p.free;
+                p.free = block->next;
+                return block;
+            }
+
+            void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment)
+            {
+                const std::size_t index = pool_index(bytes, alignment);
+                if (index == pool_count_)
+                {
+                    deallocate_large(ptr, alignment);
+                    return;
+                }
+                free_block *block = static_cast<free_block *>(ptr);
+                block->next = pools_[index].free;
+                pools_[index].free = block;
+            }
+
+            bool do_is_equal(const memory_resource &other) const
+            {
+                return this == &other;
+            }
+
+        private:
+            struct free_block
+            {
+                free_block *next;
+            };
+
+            struct chunk
+            {
+                chunk *next;
+                std::size_t size;
+            };
+
+            struct pool
+            {
+                free_block *free;
+                chunk *chunks;
+                std::size_t next_blocks; // Blocks of the next chunk, doubling up to the option
+            };
+
+            // Allocations beyond the pools, linked for release()
+            struct large_block
+            {
+                large_block *prev;
+                large_block *next;
+                std::size_t size;
+                std::size_t alignment;
+            };
+
+            static const std::size_t min_block = sizeof(free_block) < 8 ? 8 : sizeof(free_block);
+            static const std::size_t max_pools = 24;
+            static const std::size_t first_blocks = 16;
+            static const std::size_t chunk_header = (sizeof(chunk) + max_align - 1) & ~(max_align - 1);
+
+            static pool_options normalize(pool_options options)
+            {
+                if (options.max_blocks_per_chunk == 0)
+                    options.max_blocks_per_chunk = 1024;
+                if (options.largest_required_pool_block == 0)
+                    options.largest_required_pool_block = 4096;
+                options.largest_required_pool_block = std::min(options.largest_required_pool_block,
+                                                               std::size_t(min_block) << (max_pools - 1));
+                return options;
+            }
+
+            // One pool per power of two from min_block to the largest required block
+            void init_pools()
+            {
+                while ((min_block << pool_count_) < options_.largest_required_pool_block)
+                    ++pool_count_;
+                ++pool_count_;
+                for (std::size_t i = 0; i < pool_count_; ++i)
+                {
+                    pools_[i].free = NULL;
+                    pools_[i].chunks = NULL;
+                    pools_[i].next_blocks = std::min(std::size_t(first_blocks), options_.max_blocks_per_chunk);
+                }
+            }
+
+            // pool_count_ for requests no pool serves
+            std::size_t pool_index(std::size_t bytes, std::size_t alignment) const
+            {
+                if (alignment > max_align)
+                    return pool_count_;
+                const std::size_t size = std::max(bytes, alignment);
+                std::size_t index = 0;
+                while ((min_block << index) < size)
+                {
+                    if (++index == pool_count_)
+                        return pool_count_;
+                }
+                return index;
+            }
+
+            void refill(pool &p, std::size_t block_size)
+            {
+                const std::size_t size = chunk_header + p.next_blocks * block_size;
+                chunk *fresh = static_cast<chunk *>(upstream_->allocate(size, max_align));
+                fresh->next = p.chunks;
+                fresh->size = size;
+                p.chunks = fresh;
+
+                char *blocks = reinterpret_cast<char *>(fresh) + chunk_header;
+                for (std::size_t i = p.next_blocks; i > 0; --i)
+                {
+                    free_block *block = reinterpret_cast<free_block *>(blocks + (i - 1) * block_size);
+                    block->next = p.free;
+                    p.free = block;
+                }
+                p.next_blocks = std::min(p.next_blocks * 2, options_.max_blocks_per_chunk);
+            }
+
+            static std::size_t large_header(std::size_t alignment)
+            {
+                return align_up(sizeof(large_block), std::max(alignment, max_align));
+            }
+
+            void *allocate_large(std::size_t bytes, std::size_t alignment)
+            {
+                const std::size_t header = large_header(alignment);
+                const std::size_t upstream_alignment = std::max(alignment, max_align);
+                large_block *block = static_cast<large_block *>(upstream_->allocate(header + bytes, upstream_alignment));
+                block->prev = NULL;
+                block->next = large_;
+                block->size = header + bytes;
+                block->alignment = upstream_alignment;
+                if (large_ != NULL)
+                    large_->prev = block;
+                large_ = block;
+                return reinterpret_cast<char *>(block) + header;
+            }
+
+            void deallocate_large(void *ptr, std::size_t alignment)
+            {
+                large_block *block = reinterpret_cast<large_block *>(static_cast<char *>(ptr) - large_header(alignment));
+                if (block->prev != NULL)
+                    block->prev->next = block->next;
+                else
+                    large_ = block->next;
+                if (block->next != NULL)
+                    block->next->prev = block->prev;
+                upstream_->deallocate(block, block->size, block->alignment);
+            }
+
+        private:
+            memory_resource *upstream_;
+            pool_options options_;
+            std::size_t pool_count_;
+            pool pools_[max_pools];
+            large_block *large_;
+        };
+
+        class synchronized_pool_resource : public memory_resource
+        {
+        public:
+            explicit synchronized_pool_resource(const pool_options &options = pool_options(),
+                                                memory_resource *upstream = get_default_resource())
+                : pools_(options, upstream)
+            {
+            }
+
+            explicit synchronized_pool_resource(memory_resource *upstream)
+                : pools_(upstream)
+            {
+            }
+
+        private:
+            synchronized_pool_resource(const synchronized_pool_resource &);
+            synchronized_pool_resource &operator=(const synchronized_pool_resource &);
+
+        public:
+            void release()
+            {
+                lock_guard<mutex> lock(mutex_);
+                pools_.release();
+            }
+
+            memory_resource *upstream_resource() const
+            {
+                return pools_.upstream_resource();
+            }
+
+            pool_options options() const
+            {
+                return pools_.options();
+            }
+
+        protected:
+            void *do_allocate(std::size_t bytes, std::size_t alignment)
+            {
+                lock_guard<mutex> lock(mutex_);
+                return pools_.allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment)
+            {
+                lock_guard<mutex> lock(mutex_);
+                pools_.deallocate(ptr, bytes, alignment);
+            }
+
+            bool do_is_equal(const memory_resource &other) const
+            {
+                return this == &other;
+            }
+
+        private:
+            mutex mutex_;
+            unsynchronized_pool_resource pools_;
+        };
+    } // namespace pmr
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,292 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mpmc_queue.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:02:44 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 15:02:44 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MPMC_QUEUE_HPP
+# define MPMC_QUEUE_HPP
+
+# include <cstddef>
+# include <memory>
+# include <stdexcept>
+
+# include "atomic.hpp"
+
+/**
+ * @brief Bounded FIFO for any number of producer and consumer threads (Vyukov's queue). Every
+ * slot of a power-of-two ring carries a sequence number that says whose turn it is: slot i is
+ * free for the producer of position p when its sequence is p, and full for the consumer of
+ * position p when it is p + 1. A thread claims a position with one CAS on the shared enqueue or
+ * dequeue counter, then works on its slot alone; producers and consumers never share a counter.
+ *
+ * push_n and pop_n check a run of consecutive slots and claim all of them with a single CAS.
+ *
+ * A claimed slot cannot be given back, so a copy of T that throws still hands its slot on: a
+ * push whose copy throws publishes the slot marked empty, and consumers pass over it (size()
+ * counts such slots until then). A pop whose copy into out throws drops that element, and pop_n
+ * also drops the rest of the run it claimed. The exception then reaches the caller.
+ *
+ * @link https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue @endlink
+ */
+
+namespace ft
+{
+    template <typename T, typename Allocator = std::allocator<T> >
+    class mpmc_queue
+    {
+    public:
+        typedef T           value_type;
+        typedef Allocator   allocator_type;
+        typedef std::size_t size_type;
+
+    private:
+        struct cell
+        {
+            size_type sequence;
+            bool skipped; // Published by a push whose copy threw: holds no value
+            T value;      // Raw storage while the cell is free
+        };
+
+        typedef typename allocator_type::template rebind<cell>::other cell_allocator;
+
+    public:
+        // capacity is rounded up to a power of two
+        explicit mpmc_queue(size_type capacity, const allocator_type &alloc = allocator_type())
+            : enqueue_pos_(0), dequeue_pos_(0), value_alloc_(alloc), cell_alloc_(alloc),
+              mask_(round_up(capacity) - 1), cells_(cell_alloc_.allocate(mask_ + 1))
+        {
+            for (size_type i = 0; i <= mask_; ++i)
+            {
+                cells_[i].sequence = i;
+                cells_[i].skipped = false;
+            }
+        }
+
+        // Not thread-safe: no other thread may use the queue any more
+        ~mpmc_queue()
+        {
+            for (size_type pos = dequeue_pos_; pos != enqueue_pos_; ++pos)
+                if (!cells_[pos & mask_].skipped)
+                    value_alloc_.destroy(&cells_[pos & mask_].value);
+            cell_alloc_.deallocate(cells_, mask_ + 1);
+        }
+
+    public:
+        // False when full
+        bool try_push(const value_type &value)
+        {
+            size_type pos;
+            if (claim(&enqueue_pos_, 0, 1, pos) == 0)
+                return false;
+            cell &c = cells_[pos & mask_];
+            try
+            {
+                value_alloc_.construct(&c.value, value);
+            }
+            catch (...)
+            {
+                publish_skipped(pos, 1);
+                throw;
+            }
+            atomic_store(&c.sequence, pos + 1);
+            return true;
+        }
+
+        // Pushes the first elements of [first, first + count) that fit, returns how many. If a
+        // copy throws, the elements before it are still pushed.
+        template <typename InputIt>
+        size_type push_n(InputIt first, size_type count)
+        {
+            size_type pos;
+            count = claim(&enqueue_pos_, 0, count, pos);
+            size_type i = 0;
+            try
+            {
+                for (; i < count; ++i, ++first)
+                {
+                    cell &c = cells_[(pos + i) & mask_];
+                    value_alloc_.construct(&c.value, *first);
+                    atomic_store(&c.sequence, pos + i + 1);
+                }
+            }
+            catch (...)
+            {
+                publish_skipped(pos + i, count - i);
+                throw;
+            }
+            return count;
+        }
+
+        // False when empty
+        bool try_pop(value_type &out)
+        {
+            size_type pos;
+            while (claim(&dequeue_pos_, 1, 1, pos) != 0)
+            {
+                cell &c = cells_[pos & mask_];
+                if (c.skipped)
+                {
+                    release(pos);
+                    continue;
+                }
+                try
+                {
+                    out = c.value;
+                }
+                catch (...)
+                {
+                    release(pos);
+                    throw;
+                }
+                release(pos);
+                return true;
+            }
+            return false;
+        }
+
+        // Pops up to count elements into out, returns how many
+        template <typename OutputIt>
+        size_type pop_n(OutputIt out, size_type count)
+        {
+            size_type popped = 0;
+            size_type pos;
+            size_type claimed;
+            while (popped < count && (claimed = claim(&dequeue_pos_, 1, count - popped, pos)) != 0)
+            {
+                size_type i = 0;
+                try
+                {
+                    for (; i < claimed; ++i)
+                    {
+                        if (!cells_[(pos + i) & mask_].skipped)
+                        {
+                            *out = cells_[(pos + i) & mask_].value;
+                            ++out;
+                            ++popped;
+                        }
+                        release(pos + i);
+                    }
+                }
+                catch (...)
+                {
+                    for (; i < claimed; ++i)
+                        release(pos + i);
+                    throw;
+                }
+            }
+            return popped;
+        }
+
+        // Snapshots: other threads may change them right after
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        size_type size() const
+        {
+            const size_type tail = atomic_load(&enqueue_pos_);
+            const size_type head = atomic_load(&dequeue_pos_);
+            return tail > head ? tail - head : 0;
+        }
+
+        size_type capacity() const
+        {
+            return mask_ + 1;
+        }
+
+    private:
+        mpmc_queue(const mpmc_queue &);
+        mpmc_queue &operator=(const mpmc_queue &);
+
+        // Throws std::length_error when no power of two of size_type holds capacity
+        static size_type round_up(size_type capacity)
+        {
+            if (capacity > static_cast<size_type>(-1) / 2 + 1)
+                throw std::length_error("ft::mpmc_queue capacity too large");
+            size_type rounded = 2;
+            while (rounded < capacity)
+                rounded <<= 1;
+            return rounded;
+        }
+
+        // Hands count claimed producer positions from pos to the consumers as empty slots
+        void publish_skipped(size_type pos, size_type count)
+        {
+            for (size_type i = 0; i < count; ++i)
+            {
+                cell &c = cells_[(pos + i) & mask_];
+                c.skipped = true;
+                atomic_store(&c.sequence, pos + i + 1);
+            }
+        }
+
+        // Frees the cell of a claimed consumer position for the producer one lap later
+        void release(size_type pos)
+        {
+            cell &c = cells_[pos & mask_];
+            if (c.skipped)
+                c.skipped = false;
+            else
+                value_alloc_.destroy(&c.value);
+            atomic_store(&c.sequence, pos + mask_ + 1);
+        }
+
+        /**
+         * @brief Claims up to count consecutive positions from counter whose cells are ready: cell
+         * sequence == position + offset (0 for producers, 1 for consumers). Stores the first in
+         * pos and returns how many, 0 when the first cell is not ready (full or empty). A ready
+         * cell stays ready until its position is claimed, so a successful CAS owns them all.
+         */
+        size_type claim(size_type *counter, size_type offset, size_type count, size_type &pos)
+        {
+            pos = atomic_load_relaxed(counter);
+            while (true)
+            {
+                size_type ready = 0;
+                bool stale = false;
+                for (; ready < count; ++ready)
+                {
+                    const size_type seq = atomic_load(&cells_[(pos + ready) & mask_].sequence);
+                    const std::ptrdiff_t diff = std::ptrdiff_t(seq - (pos + ready + offset));
+                    if (diff != 0)
+                    {
+                        // Ahead: another thread took this position since pos was read
+                        stale = diff > 0;
+                        break;
+                    }
+                }
+                if (ready == 0)
+                {
+                    if (!stale)
+                        return 0;
+                    pos = atomic_load_relaxed(counter);
+                    continue;
+                }
+                if (atomic_compare_exchange(counter, pos, pos + ready))
+                    return ready;
+                cpu_relax();
+            }
+        }
+
+    private:
+        // Each counter is hit by one side only: one cache line each
+        size_type enqueue_pos_;
+        char enqueue_pad_[FT_CACHE_LINE_SIZE - sizeof(size_type)];
+        size_type dequeue_pos_;
+        char dequeue_pad_[FT_CACHE_LINE_SIZE - sizeof(size_type)];
+        allocator_type value_alloc_;
+        cell_allocator cell_alloc_;
+        const size_type mask_;
+        cell *cells_;
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mutex.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:10:47 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 09:10:47 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MUTEX_HPP
+# define MUTEX_HPP
+
+# include <pthread.h>
+
+namespace ft
+{
+    /**
+     * @brief Non-copyable wrapper around pthread_mutex_t, because C++98 has no std::mutex.
+     *
+     * @link https://man7.org/linux/man-pages/man3/pthread_mutex_lock.3p.html @endlink
+     */
+    class mutex
+    {
+    public:
+        mutex()
+        {
+            pthread_mutex_init(&handle_, NULL);
+        }
+
+        ~mutex()
+        {
+            pthread_mutex_destroy(&handle_);
+        }
+
+    public:
+        void lock()
+        {
+            pthread_mutex_lock(&handle_);
+        }
+
+        bool try_lock()
+        {
+            return pthread_mutex_trylock(&handle_) == 0;
+        }
+
+        void unlock()
+        {
+            pthread_mutex_unlock(&handle_);
+        }
+
+        pthread_mutex_t *native_handle()
+        {
+            return &handle_;
+        }
+
+    private:
+        mutex(const mutex &);
+        mutex &operator=(const mutex &);
+
+    private:
+        pthread_mutex_t handle_;
+    };
+
+    // Locks in the constructor, unlocks in the destructor (RAII)
+    template <typename Mutex>
+    class lock_guard
+    {
+    public:
+        explicit lock_guard(Mutex &m)
+            : m_(m)
+        {
+            m_.lock();
+        }
+
+        ~lock_guard()
+        {
+            m_.unlock();
+        }
+
+    private:
+        lock_guard(const lock_guard &);
+        lock_guard &operator=(const lock_guard &);
+
+    private:
+        Mutex &m_;
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,233 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_pool.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:21:40 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 10:21:40 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODE_POOL_HPP
+# define NODE_POOL_HPP
+
+# include <cstddef>
+# include <limits>
+# include <new>
+
+/**
+ * @brief Fixed-size block pool for node based containers. Blocks are carved out of big chunks and
+ * recycled through an intrusive free list, so a tree that keeps inserting and erasing stops hitting
+ * the global allocator. The block size is fixed by the first single-object allocation, which for a
+ * tree is always its node type.
+ *
+ * The pool is not thread-safe; give each thread (or each lock) its own pool.
+ *
+ * @link https://en.wikipedia.org/wiki/Memory_pool @endlink
+ */
+
+namespace ft
+{
+    class node_pool
+    {
+    private:
+        struct free_block
+        {
+            free_block *next;
+        };
+
+        struct chunk
+        {
+            chunk *next;
+        };
+
+    public:
+        explicit node_pool(std::size_t blocks_per_chunk = 256)
+            : object_size_(0),
+              block_size_(0),
+              blocks_per_chunk_(blocks_per_chunk == 0 ? 1 : blocks_per_chunk),
+              free_(NULL),
+              chunks_(NULL)
+        {
+        }
+
+        ~node_pool()
+        {
+            while (chunks_ != NULL)
+            {
+                chunk *next = chunks_->next;
+                ::operator delete(chunks_);
+                chunks_ = next;
+            }
+        }
+
+    public:
+        // True when blocks of `size` bytes are served by this pool
+        bool serves(std::size_t size)
+        {
+            if (object_size_ == 0)
+            {
+                object_size_ = size;
+                block_size_ = round_up(size < sizeof(free_block) ? sizeof(free_block) : size);
+            }
+            return size == object_size_;
+        }
+
+        void *allocate()
+        {
+            if (free_ == NULL)
+                grow();
+            free_block *block = free_;
+            free_ = block->next;
+            return block;
+        }
+
+        void deallocate(void *ptr)
+        {
+            free_block *block = static_cast<free_block *>(ptr);
+            block->next = free_;
+            free_ = block;
+        }
+
+        std::size_t block_size() const
+        {
+            return block_size_;
+        }
+
+    private:
+        node_pool(const node_pool &);
+        node_pool &operator=(const node_pool &);
+
+        static std::size_t round_up(std::size_t size)
+        {
+            const std::size_t align = 2 * sizeof(void *);
+            return (size + align - 1) / align * align;
+        }
+
+        void grow()
+        {
+            const std::size_t header = round_up(sizeof(chunk));
+            char *raw = static_cast<char *>(::operator new(header + block_size_ * blocks_per_chunk_));
+            chunk *c = reinterpret_cast<chunk *>(raw);
+            c->next = chunks_;
+            chunks_ = c;
+
+            char *block = raw + header;
+            for (std::size_t i = 0; i < blocks_per_chunk_; ++i, block += block_size_)
+                deallocate(block);
+        }
+
+    private:
+        std::size_t object_size_;
+        std::size_t block_size_;
+        std::size_t blocks_per_chunk_;
+        free_block *free_;
+        chunk *chunks_;
+    };
+
+    /**
+     * @brief Allocator that takes single objects from a node_pool and sends everything else to
+     * ::operator new. Copies and rebinds share the pool, two allocators compare equal when they
+     * share it.
+     */
+    template <typename T>
+    class pool_allocator
+    {
+    public:
+        typedef T value_type;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef pool_allocator<U> other;
+        };
+
+    public:
+        pool_allocator()
+            : pool_(NULL)
+        {
+        }
+
+        explicit pool_allocator(node_pool *pool)
+            : pool_(pool)
+        {
+        }
+
+        template <typename U>
+        pool_allocator(const pool_allocator<U> &other)
+            : pool_(other.pool())
+        {
+        }
+
+    public:
+        pointer allocate(size_type n, const void * = NULL)
+        {
+            if (n == 1 && pool_ != NULL && pool_->serves(sizeof(T)))
+                return static_cast<pointer>(pool_->allocate());
+            return static_cast<pointer>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(pointer ptr, size_type n)
+        {
+            if (n == 1 && pool_ != NULL && pool_->serves(sizeof(T)))
+                pool_->deallocate(ptr);
+            else
+                ::operator delete(ptr);
+        }
+
+        void construct(pointer ptr, const T &value)
+        {
+            new (static_cast<void *>(ptr)) T(value);
+        }
+
+        void destroy(pointer ptr)
+        {
+            ptr->~T();
+        }
+
+        pointer address(reference x) const
+        {
+            return &x;
+        }
+
+        const_pointer address(const_reference x) const
+        {
+            return &x;
+        }
+
+        size_type max_size() const
+        {
+            return std::numeric_limits<size_type>::max() / sizeof(T);
+        }
+
+        node_pool *pool() const
+        {
+            return pool_;
+        }
+
+    private:
+        node_pool *pool_;
+    };
+
+    template <typename T, typename U>
+    inline bool operator==(const pool_allocator<T> &lhs, const pool_allocator<U> &rhs)
+    {
+        return lhs.pool() == rhs.pool();
+    }
+
+    template <typename T, typename U>
+    inline bool operator!=(const pool_allocator<T> &lhs, const pool_allocator<U> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+} // namespace ft
+
+#endif
\ No newline at end of file
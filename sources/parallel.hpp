@@ -0,0 +1,316 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:20:55 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 14:20:55 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARALLEL_HPP
+# define PARALLEL_HPP
+
+# include <cstddef>
+
+# include "thread_pool.hpp"
+# include "tree_access.hpp"
+# include "vector.hpp"
+
+/**
+ * @brief Parallel traversal and reduction over ft::map. The red-black tree is cut at a fixed depth
+ * into work units: every subtree hanging below that depth is one unit, and every node above it is
+ * a one-element unit. The tree is balanced, so the subtree units have about the same size. The
+ * units run as fork-join tasks on an ft::thread_pool, the one passed in or default_thread_pool();
+ * the calling thread helps until all of them are done, so the algorithms may be called from a task.
+ *
+ * Units are numbered in key order: parallel_reduce combines their partial results in that order,
+ * so `combine` has to be associative but not commutative. `init` is used as the starting value of
+ * every unit and has to be the identity of `combine` (0 for a sum, 1 for a product...).
+ *
+ * The map must not be modified by anyone else during the call. `fn`, `op` and `combine` are shared
+ * by all threads and must be safe to call concurrently; they must not throw.
+ *
+ * @link https://en.wikipedia.org/wiki/Fork%E2%80%93join_model @endlink
+ * @link https://oneapi-src.github.io/oneTBB/main/tbb_userguide/parallel_reduce.html @endlink
+ */
+
+namespace ft
+{
+    // Splits a tree (optionally restricted to the keys in [lo, hi)) into ordered work units
+    template <typename Tree, typename Key>
+    class tree_partition
+    {
+    public:
+        typedef typename Tree::value_type value_type;
+        typedef typename tree_node_types<value_type>::node_pointer node_pointer;
+
+    private:
+        struct unit
+        {
+            node_pointer node;
+            bool whole; // The whole subtree, or only the node itself
+
+            unit(node_pointer n, bool w) : node(n), whole(w)
+            {
+            }
+        };
+
+    public:
+        tree_partition(const Tree &tree, const Key *lo, const Key *hi, std::size_t depth)
+            : comp_(tree.value_comp()), lo_(lo), hi_(hi)
+        {
+            split(tree_access::root(tree), depth);
+        }
+
+    public:
+        std::size_t size() const
+        {
+            return units_.size();
+        }
+
+        // Calls visitor on every element of unit i, in key order
+        template <typename Visitor>
+        void run(std::size_t i, Visitor &visitor) const
+        {
+            if (units_[i].whole)
+                visit(units_[i].node, visitor);
+            else
+                visitor(units_[i].node->value);
+        }
+
+    private:
+        bool above_lo(node_pointer node) const
+        {
+            return lo_ == NULL || !comp_(node->value, *lo_);
+        }
+
+        bool below_hi(node_pointer node) const
+        {
+            return hi_ == NULL || comp_(node->value, *hi_);
+        }
+
+        void split(node_pointer node, std::size_t depth)
+        {
+            if (node == NULL)
+                return;
+            if (depth == 0)
+            {
+                units_.push_back(unit(node, true));
+                return;
+            }
+            bool lo_ok = above_lo(node);
+            bool hi_ok = below_hi(node);
+            if (lo_ok)
+                split(node->left, depth - 1);
+            if (lo_ok && hi_ok)
+                units_.push_back(unit(node, false));
+            if (hi_ok)
+                split(node->right, depth - 1);
+        }
+
+        template <typename Visitor>
+        void visit(node_pointer node, Visitor &visitor) const
+        {
+            if (node == NULL)
+                return;
+            bool lo_ok = above_lo(node);
+            bool hi_ok = below_hi(node);
+            if (lo_ok)
+                visit(node->left, visitor);
+            if (lo_ok && hi_ok)
+                visitor(node->value);
+            if (hi_ok)
+                visit(node->right, visitor);
+        }
+
+    private:
+        typename Tree::value_compare comp_;
+        const Key *lo_;
+        const Key *hi_;
+        vector<unit> units_;
+    };
+
+    // Runs job.run(i) for one unit, what thread_pool::parallel_for calls; a copy shares the job
+    template <typename Job>
+    class parallel_unit
+    {
+    public:
+        explicit parallel_unit(Job &job) : job_(&job)
+        {
+        }
+
+        void operator()(std::size_t i) const
+        {
+            job_->run(i);
+        }
+
+    private:
+        Job *job_;
+    };
+
+    // Deep enough for about 8 units per thread, 0 (one unit) when it is not worth a thread
+    inline std::size_t parallel_split_depth(std::size_t size, unsigned int threads)
+    {
+        if (threads <= 1 || size < 4096)
+            return 0;
+        std::size_t depth = 0;
+        while ((std::size_t(1) << depth) < std::size_t(threads) * 8)
+            ++depth;
+        return depth;
+    }
+
+    template <typename Partition, typename Function>
+    class parallel_for_each_job
+    {
+    public:
+        parallel_for_each_job(const Partition &partition, Function &fn)
+            : partition_(partition), fn_(fn)
+        {
+        }
+
+        void run(std::size_t i)
+        {
+            partition_.run(i, fn_);
+        }
+
+    private:
+        const Partition &partition_;
+        Function &fn_;
+    };
+
+    template <typename Partition, typename T, typename Op>
+    class parallel_reduce_job
+    {
+    private:
+        struct accumulate
+        {
+            const Op &op;
+            T acc;
+
+            accumulate(const Op &o, const T &init) : op(o), acc(init)
+            {
+            }
+
+            template <typename Value>
+            void operator()(const Value &value)
+            {
+                acc = op(acc, value);
+            }
+        };
+
+    public:
+        parallel_reduce_job(const Partition &partition, const T &init, const Op &op)
+            : partition_(partition), init_(init), op_(op), results_(partition.size(), init)
+        {
+        }
+
+        void run(std::size_t i)
+        {
+            accumulate visitor(op_, init_);
+            partition_.run(i, visitor);
+            results_[i] = visitor.acc;
+        }
+
+        template <typename Combine>
+        T combine(Combine combine) const
+        {
+            T total = init_;
+            for (std::size_t i = 0; i < results_.size(); ++i)
+                total = combine(total, results_[i]);
+            return total;
+        }
+
+    private:
+        const Partition &partition_;
+        const T &init_;
+        const Op &op_;
+        vector<T> results_;
+    };
+
+    template <typename Map, typename Function>
+    void parallel_for_each_impl(Map &m, const typename Map::key_type *lo,
+                                const typename Map::key_type *hi, Function &fn, thread_pool &pool)
+    {
+        typedef typename tree_access::tree_of<Map>::type tree_type;
+        typedef tree_partition<tree_type, typename Map::key_type> partition_type;
+        typedef parallel_for_each_job<partition_type, Function> job_type;
+        partition_type partition(tree_access::tree(m), lo, hi, parallel_split_depth(m.size(), pool.size()));
+        job_type job(partition, fn);
+        pool.parallel_for(0, partition.size(), parallel_unit<job_type>(job), 1);
+    }
+
+    template <typename Map, typename T, typename Op, typename Combine>
+    T parallel_reduce_impl(const Map &m, const typename Map::key_type *lo,
+                           const typename Map::key_type *hi, const T &init, const Op &op,
+                           Combine combine, thread_pool &pool)
+    {
+        typedef typename tree_access::tree_of<Map>::type tree_type;
+        typedef tree_partition<tree_type, typename Map::key_type> partition_type;
+        typedef parallel_reduce_job<partition_type, T, Op> job_type;
+        partition_type partition(tree_access::tree(m), lo, hi, parallel_split_depth(m.size(), pool.size()));
+        job_type job(partition, init, op);
+        pool.parallel_for(0, partition.size(), parallel_unit<job_type>(job), 1);
+        return job.combine(combine);
+    }
+
+    // Calls fn(value) for every element, in no particular order, on default_thread_pool()
+    template <typename Map, typename Function>
+    void parallel_for_each(Map &m, Function fn)
+    {
+        parallel_for_each_impl(m, NULL, NULL, fn, default_thread_pool());
+    }
+
+    template <typename Map, typename Function>
+    void parallel_for_each(Map &m, Function fn, thread_pool &pool)
+    {
+        parallel_for_each_impl(m, NULL, NULL, fn, pool);
+    }
+
+    // Same, restricted to the keys in [first, last)
+    template <typename Map, typename Function>
+    void parallel_for_each(Map &m, const typename Map::key_type &first,
+                           const typename Map::key_type &last, Function fn)
+    {
+        parallel_for_each_impl(m, &first, &last, fn, default_thread_pool());
+    }
+
+    template <typename Map, typename Function>
+    void parallel_for_each(Map &m, const typename Map::key_type &first,
+                           const typename Map::key_type &last, Function fn, thread_pool &pool)
+    {
+        parallel_for_each_impl(m, &first, &last, fn, pool);
+    }
+
+    // combine(... combine(combine(init, op(op(init, e0), e1)...)...)), see the notes at the top
+    template <typename Map, typename T, typename Op, typename Combine>
+    T parallel_reduce(const Map &m, T init, Op op, Combine combine)
+    {
+        return parallel_reduce_impl(m, NULL, NULL, init, op, combine, default_thread_pool());
+    }
+
+    template <typename Map, typename T, typename Op, typename Combine>
+    T parallel_reduce(const Map &m, T init, Op op, Combine combine, thread_pool &pool)
+    {
+        return parallel_reduce_impl(m, NULL, NULL, init, op, combine, pool);
+    }
+
+    template <typename Map, typename T, typename Op, typename Combine>
+    T parallel_reduce(const Map &m, const typename Map::key_type &first,
+                      const typename Map::key_type &last, T init, Op op, Combine combine)
+    {
+        return parallel_reduce_impl(m, &first, &last, init, op, combine, default_thread_pool());
+    }
+
+    template <typename Map, typename T, typename Op, typename Combine>
+    T parallel_reduce(const Map &m, const typename Map::key_type &first,
+                      const typename Map::key_type &last, T init, Op op, Combine combine,
+                      thread_pool &pool)
+    {
+        return parallel_reduce_impl(m, &first, &last, init, op, combine, pool);
+    }
+} // namespace ft
+
+#endif
\ No newline at end of file
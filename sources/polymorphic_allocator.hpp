@@ -0,0 +1,282 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   polymorphic_allocator.hpp                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:03:48 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 10:03:48 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef POLYMORPHIC_ALLOCATOR_HPP
+# define POLYMORPHIC_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <cstdlib>
+# include <new>
+
+# include "atomic.hpp"
+
+/**
+ * @brief The core of C++17 <memory_resource> for the ft containers: memory_resource, the
+ * new/delete and null resources, the process default resource and polymorphic_allocator. Every
+ * container has a pmr alias next to it; C++98 has no alias templates, so they are nested
+ * typedefs: `ft::pmr::vector<int>::type`, `ft::pmr::map<int, std::string>::type`. The arena
+ * resources are in memory_resource.hpp.
+ *
+ * Differences from the standard:
+ *  - memory_resource::deallocation_is_noop() tells containers that a resource takes its memory
+ *    back in bulk (monotonic_buffer_resource), so they can drop trivially destructible elements
+ *    without visiting them.
+ *  - polymorphic_allocator is assignable (C++98 containers assign allocators to swap them) and
+ *    does not pass itself to the elements it constructs (no uses-allocator construction).
+ *
+ * @link https://en.cppreference.com/w/cpp/header/memory_resource @endlink
+ * @link https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2014/n3916.pdf @endlink
+ */
+
+namespace ft
+{
+    namespace pmr
+    {
+        // Alignment of the memory operator new returns, the default of allocate()
+        static const std::size_t max_align = __alignof__(long double);
+
+        class memory_resource
+        {
+        public:
+            virtual ~memory_resource()
+            {
+            }
+
+            void *allocate(std::size_t bytes, std::size_t alignment = max_align)
+            {
+                return do_allocate(bytes, alignment);
+            }
+
+            void deallocate(void *ptr, std::size_t bytes, std::size_t alignment = max_align)
+            {
+                do_deallocate(ptr, bytes, alignment);
+            }
+
+            bool is_equal(const memory_resource &other) const
+            {
+                return do_is_equal(other);
+            }
+
+            bool deallocation_is_noop() const
+            {
+                return do_deallocation_is_noop();
+            }
+
+        protected:
+            virtual void *do_allocate(std::size_t bytes, std::size_t alignment) = 0;
+            virtual void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) = 0;
+            virtual bool do_is_equal(const memory_resource &other) const = 0;
+
+            virtual bool do_deallocation_is_noop() const
+            {
+                return false;
+            }
+        };
+
+        inline bool operator==(const memory_resource &lhs, const memory_resource &rhs)
+        {
+            return &lhs == &rhs || lhs.is_equal(rhs);
+        }
+
+        inline bool operator!=(const memory_resource &lhs, const memory_resource &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        // operator new and delete; posix_memalign for over-aligned requests
+        class new_delete_memory_resource : public memory_resource
+        {
+        protected:
+            void *do_allocate(std::size_t bytes, std::size_t alignment)
+            {
+                if (alignment <= max_align)
+                    return ::operator new(bytes);
+                void *ptr = NULL;
+                if (posix_memalign(&ptr, alignment, bytes) != 0)
+                    throw std::bad_alloc();
+                return ptr;
+            }
+
+            void do_deallocate(void *ptr, std::size_t, std::size_t alignment)
+            {
+                if (alignment <= max_align)
+                    ::operator delete(ptr);
+                else
+                    std::free(ptr);
+            }
+
+            bool do_is_equal(const memory_resource &other) const
+            {
+                return this == &other;
+            }
+        };
+
+        // Fails every allocation, to catch a buffer resource going upstream
+        class null_memory_resource_type : public memory_resource
+        {
+        protected:
+            void *do_allocate(std::size_t, std::size_t)
+            {
+                throw std::bad_alloc();
+            }
+
+            void do_deallocate(void *, std::size_t, std::size_t)
+            {
+            }
+
+            bool do_is_equal(const memory_resource &other) const
+            {
+                return this == &other;
+            }
+        };
+
+        inline memory_resource *new_delete_resource()
+        {
+            static new_delete_memory_resource resource;
+            return &resource;
+        }
+
+        inline memory_resource *null_memory_resource()
+        {
+            static null_memory_resource_type resource;
+            return &resource;
+        }
+
+        inline memory_resource **default_resource_slot()
+        {
+            static memory_resource *resource = NULL;
+            return &resource;
+        }
+
+        inline memory_resource *get_default_resource()
+        {
+            memory_resource *resource = atomic_load(default_resource_slot());
+            return resource == NULL ? new_delete_resource() : resource;
+        }
+
+        // NULL restores new_delete_resource(); returns the previous default
+        inline memory_resource *set_default_resource(memory_resource *resource)
+        {
+            if (resource == NULL)
+                resource = new_delete_resource();
+            memory_resource *previous = atomic_exchange(default_resource_slot(), resource);
+            return previous == NULL ? new_delete_resource() : previous;
+        }
+
+        template <typename T>
+        class polymorphic_allocator
+        {
+        public:
+            typedef T value_type;
+            typedef T *pointer;
+            typedef const T *const_pointer;
+            typedef T &reference;
+            typedef const T &const_reference;
+            typedef std::size_t size_type;
+            typedef std::ptrdiff_t difference_type;
+
+            template <typename U>
+            struct rebind
+            {
+                typedef polymorphic_allocator<U> other;
+            };
+
+        public:
+            polymorphic_allocator()
+                : resource_(get_default_resource())
+            {
+            }
+
+            polymorphic_allocator(memory_resource *resource)
+                : resource_(resource)
+            {
+            }
+
+            template <typename U>
+            polymorphic_allocator(const polymorphic_allocator<U> &other)
+                : resource_(other.resource())
+            {
+            }
+
+        public:
+            pointer allocate(size_type count, const void * = NULL)
+            {
+                if (count > max_size())
+                    throw std::bad_alloc();
+                return static_cast<pointer>(resource_->allocate(count * sizeof(T), __alignof__(T)));
+            }
+
+            void deallocate(pointer ptr, size_type count)
+            {
+                resource_->deallocate(ptr, count * sizeof(T), __alignof__(T));
+            }
+
+            void construct(pointer ptr, const T &value)
+            {
+                new (static_cast<void *>(ptr)) T(value);
+            }
+
+            void destroy(pointer ptr)
+            {
+                ptr->~T();
+            }
+
+            pointer address(reference value) const
+            {
+                return &value;
+            }
+
+            const_pointer address(const_reference value) const
+            {
+                return &value;
+            }
+
+            size_type max_size() const
+            {
+                return static_cast<size_type>(-1) / sizeof(T);
+            }
+
+            // A copied container goes back to the default resource, as in the standard
+            polymorphic_allocator select_on_container_copy_construction() const
+            {
+                return polymorphic_allocator();
+            }
+
+            bool deallocation_is_noop() const
+            {
+                return resource_->deallocation_is_noop();
+            }
+
+            memory_resource *resource() const
+            {
+                return resource_;
+            }
+
+        private:
+            memory_resource *resource_;
+        };
+
+        template <typename T, typename U>
+        inline bool operator==(const polymorphic_allocator<T> &lhs, const polymorphic_allocator<U> &rhs)
+        {
+            return *lhs.resource() == *rhs.resource();
+        }
+
+        template <typename T, typename U>
+        inline bool operator!=(const polymorphic_allocator<T> &lhs, const polymorphic_allocator<U> &rhs)
+        {
+            return !(lhs == rhs);
+        }
+    } // namespace pmr
+} // namespace ft
+
+#endif
\ No newline at end of file
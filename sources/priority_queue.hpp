@@ -0,0 +1,240 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   priority_queue.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:07:52 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 13:07:52 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PRIORITY_QUEUE_HPP
+# define PRIORITY_QUEUE_HPP
+
+# include <cstddef>
+# include <functional>
+
+# include "allocator_traits.hpp"
+# include "type_trait.hpp"
+# include "vector.hpp"
+
+/**
+ * @brief Priority queue adaptor over a d-ary max-heap stored in a random access container
+ * (ft::vector, ft::deque, ft::static_vector...). top() is the greatest element by Compare.
+ *
+ * Every node has Arity children (4 by default, at least 2). A wider node makes the heap
+ * shallower, so pop and sift-down visit fewer levels, and the children of a node sit next to
+ * each other: with 4 children of a small T they share a cache line. Sifts move a hole instead
+ * of swapping, one copy per level.
+ *
+ *  - push_range appends a whole range and rebuilds the heap bottom-up (Floyd) in O(n) when the
+ *    range is big compared to the queue; a small range is sifted up element by element.
+ *  - pop_push(value) replaces the top with value and does a single sift-down: cheaper than
+ *    pop() followed by push() for schedulers that reinsert the element they just took.
+ *
+ * @link https://en.wikipedia.org/wiki/D-ary_heap @endlink
+ * @link https://en.cppreference.com/w/cpp/container/priority_queue @endlink
+ */
+
+namespace ft
+{
+    template <typename T, typename Container = ft::vector<T>,
+              typename Compare = std::less<typename Container::value_type>, std::size_t Arity = 4>
+    class priority_queue
+    {
+    public:
+        typedef T                                       value_type;
+        typedef Container                               container_type;
+        typedef Compare                                 value_compare;
+        typedef typename container_type::size_type      size_type;
+        typedef typename container_type::reference      reference;
+        typedef typename container_type::const_reference const_reference;
+
+        static const std::size_t arity = Arity;
+
+    private:
+        // C++98 static assert: an array of negative size does not compile when Arity < 2
+        typedef char arity_must_be_at_least_2[Arity >= 2 ? 1 : -1];
+
+    protected:
+        container_type c;
+        value_compare comp;
+
+    public:
+        explicit priority_queue(const value_compare &compare = value_compare(),
+                                const container_type &ctnr = container_type())
+            : c(ctnr), comp(compare)
+        {
+            make_heap();
+        }
+
+        template <typename InputIt>
+        priority_queue(InputIt first, InputIt last, const value_compare &compare = value_compare(),
+                       const container_type &ctnr = container_type())
+            : c(ctnr), comp(compare)
+        {
+            for (; first != last; ++first)
+                c.push_back(*first);
+            make_heap();
+        }
+
+        // Allocator-extended constructors: the container's memory comes from alloc
+        template <typename Alloc>
+        explicit priority_queue(const Alloc &alloc,
+                                typename enable_if<uses_allocator<container_type, Alloc>::value>::type * = NULL)
+            : c(alloc), comp()
+        {
+        }
+
+        template <typename Alloc>
+        priority_queue(const value_compare &compare, const Alloc &alloc,
+                       typename enable_if<uses_allocator<container_type, Alloc>::value>::type * = NULL)
+            : c(alloc), comp(compare)
+        {
+        }
+
+        template <typename Alloc>
+        priority_queue(const value_compare &compare, const container_type &ctnr, const Alloc &alloc,
+                       typename enable_if<uses_allocator<container_type, Alloc>::value>::type * = NULL)
+            : c(ctnr, alloc), comp(compare)
+        {
+            make_heap();
+        }
+
+        template <typename Alloc>
+        priority_queue(const priority_queue &other, const Alloc &alloc,
+                       typename enable_if<uses_allocator<container_type, Alloc>::value>::type * = NULL)
+            : c(other.c, alloc), comp(other.comp)
+        {
+        }
+
+    public:
+        bool empty() const
+        {
+            return c.empty();
+        }
+
+        size_type size() const
+        {
+            return c.size();
+        }
+
+        const_reference top() const
+        {
+            return c.front();
+        }
+
+        void push(const value_type &value)
+        {
+            c.push_back(value);
+            sift_up(c.size() - 1);
+        }
+
+        template <typename InputIt>
+        void push_range(InputIt first, InputIt last)
+        {
+            const size_type old_size = c.size();
+            for (; first != last; ++first)
+                c.push_back(*first);
+            const size_type added = c.size() - old_size;
+            // k sift-ups cost about k * log(n) moves, a rebuild about 2n
+            if (added * 4 < old_size)
+                for (size_type i = old_size; i < c.size(); ++i)
+                    sift_up(i);
+            else
+                make_heap();
+        }
+
+        void pop()
+        {
+            if (c.size() > 1)
+            {
+                value_type last = c.back();
+                c.pop_back();
+                sift_down(0, last);
+            }
+            else
+                c.pop_back();
+        }
+
+        // pop() then push(value), with one sift-down
+        void pop_push(const value_type &value)
+        {
+            if (c.empty())
+                push(value);
+            else
+                sift_down(0, value_type(value));
+        }
+
+        void swap(priority_queue &other)
+        {
+            c.swap(other.c);
+            std::swap(comp, other.comp);
+        }
+
+    private:
+        // Moves the element at i up to its place
+        void sift_up(size_type i)
+        {
+            value_type value = c[i];
+            while (i > 0)
+            {
+                const size_type parent = (i - 1) / Arity;
+                if (!comp(c[parent], value))
+                    break;
+                c[i] = c[parent];
+                i = parent;
+            }
+            c[i] = value;
+        }
+
+        // Puts value in the hole at i and moves it down to its place
+        void sift_down(size_type i, const value_type &value)
+        {
+            const size_type n = c.size();
+            while (true)
+            {
+                const size_type first_child = i * Arity + 1;
+                if (first_child >= n)
+                    break;
+                const size_type last_child = first_child + Arity < n ? first_child + Arity : n;
+                size_type best = first_child;
+                for (size_type child = first_child + 1; child < last_child; ++child)
+                    if (comp(c[best], c[child]))
+                        best = child;
+                if (!comp(value, c[best]))
+                    break;
+                c[i] = c[best];
+                i = best;
+            }
+            c[i] = value;
+        }
+
+        // Floyd: sift down every parent, last one first
+        void make_heap()
+        {
+            const size_type n = c.size();
+            if (n < 2)
+                return;
+            for (size_type i = (n - 2) / Arity + 1; i > 0; --i)
+            {
+                value_type value = c[i - 1];
+                sift_down(i - 1, value);
+            }
+        }
+    };
+
+    template <typename T, typename Container, typename Compare, std::size_t Arity>
+    const std::size_t priority_queue<T, Container, Compare, Arity>::arity;
+
+    template <typename T, typename Container, typename Compare, std::size_t Arity>
+    inline void swap(priority_queue<T, Container, Compare, Arity> &lhs,
+                     priority_queue<T, Container, Compare, Arity> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+} // namespace ft
+
+#endif
\ No newline at end of file
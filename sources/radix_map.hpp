@@ -0,0 +1,1308 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   radix_map.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:05:33 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 18:05:33 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RADIX_MAP_HPP
+# define RADIX_MAP_HPP
+
+# include <algorithm>
+# include <cstddef>
+# include <cstring>
+# include <iterator>
+# include <limits>
+# include <memory>
+# include <stdexcept>
+# include <string>
+
+# if defined(__SSE2__)
+#  include <emmintrin.h>
+# endif
+
+# include "iterator.hpp"
+# include "polymorphic_allocator.hpp"
+# include "utility.hpp"
+
+/**
+ * @brief Ordered map over an adaptive radix tree (ART). Keys are turned into byte strings whose
+ * byte order is the key order (radix_key_traits), and the tree branches on one byte per level:
+ * a lookup costs one step per key byte, never a full key comparison, and keys sharing a long
+ * prefix (URLs, paths) share the nodes that hold it.
+ *
+ * Inner nodes come in four sizes chosen by their fan-out: Node4 and Node16 hold sorted key bytes
+ * next to their children (Node16 is searched with one SSE2 compare), Node48 maps all 256 bytes to
+ * 48 child slots, Node256 is a plain array. Chains of single-child nodes are collapsed into a
+ * prefix kept in the node below (path compression), and a subtree holding a single key is just
+ * its leaf (lazy expansion), so the depth is bounded by the distinguishing bytes only.
+ *
+ * Leaves are also linked in key order, so iteration is a list walk and iterators are one pointer.
+ *
+ * @link https://db.in.tum.de/~leis/papers/ART.pdf @endlink
+ * @link https://en.wikipedia.org/wiki/Radix_tree @endlink
+ */
+
+namespace ft
+{
+    /**
+     * @brief Byte encoding of keys for radix_map: encode() must be order preserving (the byte
+     * strings compare like the keys) and prefix free (no encoding is a prefix of another).
+     * encode_prefix() encodes a key as a prefix for radix_map::prefix_range. Specialize it for
+     * other key types.
+     */
+    template <typename Key>
+    struct radix_key_traits;
+
+    // Fixed width and big-endian, so byte order is numeric order
+    template <typename T>
+    struct radix_unsigned_key_traits
+    {
+        static void encode(T key, std::string &out)
+        {
+            out.resize(sizeof(T));
+            for (std::size_t i = sizeof(T); i != 0; --i)
+            {
+                out[i - 1] = static_cast<char>(static_cast<unsigned char>(key & 0xff));
+                key = static_cast<T>(key >> 8);
+            }
+        }
+
+        static void encode_prefix(T key, std::string &out)
+        {
+            encode(key, out);
+        }
+    };
+
+    // Flipping the sign bit moves negative numbers below the positive ones
+    template <typename T, typename Unsigned>
+    struct radix_signed_key_traits
+    {
+        static void encode(T key, std::string &out)
+        {
+            const Unsigned sign = static_cast<Unsigned>(Unsigned(1) << (sizeof(T) * 8 - 1));
+            radix_unsigned_key_traits<Unsigned>::encode(static_cast<Unsigned>(static_cast<Unsigned>(key) ^ sign), out);
+        }
+
+        static void encode_prefix(T key, std::string &out)
+        {
+            encode(key, out);
+        }
+    };
+
+    template <> struct radix_key_traits<unsigned char> : public radix_unsigned_key_traits<unsigned char> {};
+    template <> struct radix_key_traits<unsigned short> : public radix_unsigned_key_traits<unsigned short> {};
+    template <> struct radix_key_traits<unsigned int> : public radix_unsigned_key_traits<unsigned int> {};
+    template <> struct radix_key_traits<unsigned long> : public radix_unsigned_key_traits<unsigned long> {};
+    template <> struct radix_key_traits<unsigned long long> : public radix_unsigned_key_traits<unsigned long long> {};
+    template <> struct radix_key_traits<signed char> : public radix_signed_key_traits<signed char, unsigned char> {};
+    template <> struct radix_key_traits<short> : public radix_signed_key_traits<short, unsigned short> {};
+    template <> struct radix_key_traits<int> : public radix_signed_key_traits<int, unsigned int> {};
+    template <> struct radix_key_traits<long> : public radix_signed_key_traits<long, unsigned long> {};
+    template <> struct radix_key_traits<long long> : public radix_signed_key_traits<long long, unsigned long long> {};
+
+    // Bytes as they are, 0x00 escaped as 00 FF, then a 00 00 terminator: ordered and prefix free
+    template <>
+    struct radix_key_traits<std::string>
+    {
+        static void encode_prefix(const std::string &key, std::string &out)
+        {
+            out.clear();
+            out.reserve(key.size() + 2);
+            for (std::size_t i = 0; i < key.size(); ++i)
+            {
+                out += key[i];
+                if (key[i] == '\0')
+                    out += '\xff';
+            }
+        }
+
+        static void encode(const std::string &key, std::string &out)
+        {
+            encode_prefix(key, out);
+            out += '\0';
+            out += '\0';
+        }
+    };
+
+    enum radix_node_type
+    {
+        radix_leaf_node,
+        radix_node4_type,
+        radix_node16_type,
+        radix_node48_type,
+        radix_node256_type
+    };
+
+    struct radix_node
+    {
+        unsigned char type;
+
+        explicit radix_node(radix_node_type t) : type(static_cast<unsigned char>(t))
+        {
+        }
+    };
+
+    // Key-ordered list of the leaves; the map's header closes it into a ring
+    struct radix_link
+    {
+        radix_link *prev;
+        radix_link *next;
+
+        radix_link() : prev(this), next(this)
+        {
+        }
+
+        // Puts this right before pos
+        void link_before(radix_link *pos)
+        {
+            next = pos;
+            prev = pos->prev;
+            pos->prev->next = this;
+            pos->prev = this;
+        }
+
+        void unlink()
+        {
+            prev->next = next;
+            next->prev = prev;
+        }
+    };
+
+    template <typename Value>
+    struct radix_leaf : public radix_node, public radix_link
+    {
+        Value value;
+
+        explicit radix_leaf(const Value &v) : radix_node(radix_leaf_node), radix_link(), value(v)
+        {
+        }
+    };
+
+    struct radix_inner : public radix_node
+    {
+        unsigned short count;
+        std::string prefix; // Compressed path: bytes every key below shares after the parent's
+
+        explicit radix_inner(radix_node_type t) : radix_node(t), count(0), prefix()
+        {
+        }
+    };
+
+    struct radix_node4 : public radix_inner
+    {
+        enum { capacity = 4 };
+        unsigned char keys[capacity]; // Sorted
+        radix_node *children[capacity];
+
+        radix_node4() : radix_inner(radix_node4_type)
+        {
+        }
+    };
+
+    struct radix_node16 : public radix_inner
+    {
+        enum { capacity = 16 };
+        unsigned char keys[capacity]; // Sorted
+        radix_node *children[capacity];
+
+        radix_node16() : radix_inner(radix_node16_type)
+        {
+        }
+    };
+
+    struct radix_node48 : public radix_inner
+    {
+        enum { capacity = 48 };
+        unsigned char index[256]; // Slot + 1 of each byte's child, 0 for none
+        radix_node *children[capacity];
+
+        radix_node48() : radix_inner(radix_node48_type)
+        {
+            std::memset(index, 0, sizeof(index));
+        }
+    };
+
+    struct radix_node256 : public radix_inner
+    {
+        enum { capacity = 256 };
+        radix_node *children[capacity];
+
+        radix_node256() : radix_inner(radix_node256_type)
+        {
+            std::memset(children, 0, sizeof(children));
+        }
+    };
+
+    inline std::size_t radix_capacity(const radix_inner *node)
+    {
+        switch (node->type)
+        {
+        case radix_node4_type:
+            return radix_node4::capacity;
+        case radix_node16_type:
+            return radix_node16::capacity;
+        case radix_node48_type:
+            return radix_node48::capacity;
+        default:
+            return radix_node256::capacity;
+        }
+    }
+
+    // Slot holding the child for byte, NULL when there is none
+    inline radix_node **radix_find_child(radix_inner *node, unsigned char byte)
+    {
+        switch (node->type)
+        {
+        case radix_node4_type:
+        {
+            radix_node4 *n = static_cast<radix_node4 *>(node);
+            for (unsigned int i = 0; i < n->count; ++i)
+                if (n->keys[i] == byte)
+                    return &n->children[i];
+            return NULL;
+        }
+        case radix_node16_type:
+        {
+            radix_node16 *n = static_cast<radix_node16 *>(node);
+# if defined(__SSE2__)
+            __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i *>(n->keys));
+            unsigned int mask = static_cast<unsigned int>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)))));
+            mask &= (1u << n->count) - 1;
+            return mask == 0 ? NULL : &n->children[__builtin_ctz(mask)];
+# else
+            for (unsigned int i = 0; i < n->count; ++i)
+                if (n->keys[i] == byte)
+                    return &n->children[i];
+            return NULL;
+# endif
+        }
+        case radix_node48_type:
+        {
+            radix_node48 *n = static_cast<radix_node48 *>(node);
+            return n->index[byte] == 0 ? NULL : &n->children[n->index[byte] - 1];
+        }
+        default:
+        {
+            radix_node256 *n = static_cast<radix_node256 *>(node);
+            return n->children[byte] == NULL ? NULL : &n->children[byte];
+        }
+        }
+    }
+
+    // First child whose byte is >= from (from may be 256), its byte stored in *byte
+    inline radix_node *radix_child_from(const radix_inner *node, unsigned int from, unsigned char *byte = NULL)
+    {
+        switch (node->type)
+        {
+        case radix_node4_type:
+        case radix_node16_type:
+        {
+            const unsigned char *keys;
+            radix_node *const *children;
+            if (node->type == radix_node4_type)
+            {
+                keys = static_cast<const radix_node4 *>(node)->keys;
+                children = static_cast<const radix_node4 *>(node)->children;
+            }
+            else
+            {
+                keys = static_cast<const radix_node16 *>(node)->keys;
+                children = static_cast<const radix_node16 *>(node)->children;
+            }
+            for (unsigned int i = 0; i < node->count; ++i)
+            {
+                if (keys[i] >= from)
+                {
+                    if (byte != NULL)
+                        *byte = keys[i];
+                    return children[i];
+                }
+            }
+            return NULL;
+        }
+        case radix_node48_type:
+        {
+            const radix_node48 *n = static_cast<const radix_node48 *>(node);
+            for (unsigned int b = from; b < 256; ++b)
+            {
+                if (n->index[b] != 0)
+                {
+                    if (byte != NULL)
+                        *byte = static_cast<unsigned char>(b);
+                    return n->children[n->index[b] - 1];
+                }
+            }
+            return NULL;
+        }
+        default:
+        {
+            const radix_node256 *n = static_cast<const radix_node256 *>(node);
+            for (unsigned int b = from; b < 256; ++b)
+            {
+                if (n->children[b] != NULL)
+                {
+                    if (byte != NULL)
+                        *byte = static_cast<unsigned char>(b);
+                    return n->children[b];
+                }
+            }
+            return NULL;
+        }
+        }
+    }
+
+    inline radix_node *radix_last_child(const radix_inner *node)
+    {
+        switch (node->type)
+        {
+        case radix_node4_type:
+            return static_cast<const radix_node4 *>(node)->children[node->count - 1];
+        case radix_node16_type:
+            return static_cast<const radix_node16 *>(node)->children[node->count - 1];
+        case radix_node48_type:
+        {
+            const radix_node48 *n = static_cast<const radix_node48 *>(node);
+            for (unsigned int b = 256; b != 0; --b)
+                if (n->index[b - 1] != 0)
+                    return n->children[n->index[b - 1] - 1];
+            return NULL;
+        }
+        default:
+        {
+            const radix_node256 *n = static_cast<const radix_node256 *>(node);
+            for (unsigned int b = 256; b != 0; --b)
+                if (n->children[b - 1] != NULL)
+                    return n->children[b - 1];
+            return NULL;
+        }
+        }
+    }
+
+    inline radix_node *radix_min_leaf(radix_node *node)
+    {
+        while (node->type != radix_leaf_node)
+            node = radix_child_from(static_cast<const radix_inner *>(node), 0);
+        return node;
+    }
+
+    inline radix_node *radix_max_leaf(radix_node *node)
+    {
+        while (node->type != radix_leaf_node)
+            node = radix_last_child(static_cast<const radix_inner *>(node));
+        return node;
+    }
+
+    // Adds a child to a node that is not full
+    inline void radix_add_child(radix_inner *node, unsigned char byte, radix_node *child)
+    {
+        switch (node->type)
+        {
+        case radix_node4_type:
+        case radix_node16_type:
+        {
+            unsigned char *keys;
+            radix_node **children;
+            if (node->type == radix_node4_type)
+            {
+                keys = static_cast<radix_node4 *>(node)->keys;
+                children = static_cast<radix_node4 *>(node)->children;
+            }
+            else
+            {
+                keys = static_cast<radix_node16 *>(node)->keys;
+                children = static_cast<radix_node16 *>(node)->children;
+            }
+            unsigned int i = node->count;
+            for (; i != 0 && keys[i - 1] > byte; --i)
+            {
+                keys[i] = keys[i - 1];
+                children[i] = children[i - 1];
+            }
+            keys[i] = byte;
+            children[i] = child;
+            break;
+        }
+        case radix_node48_type:
+        {
+            // Slots stay packed: removal moves the last one into the hole
+            radix_node48 *n = static_cast<radix_node48 *>(node);
+            n->children[n->count] = child;
+            n->index[byte] = static_cast<unsigned char>(n->count + 1);
+            break;
+        }
+        default:
+            static_cast<radix_node256 *>(node)->children[byte] = child;
+            break;
+        }
+        ++node->count;
+    }
+
+    inline void radix_remove_child(radix_inner *node, unsigned char byte)
+    {
+        switch (node->type)
+        {
+        case radix_node4_type:
+        case radix_node16_type:
+        {
+            unsigned char *keys;
+            radix_node **children;
+            if (node->type == radix_node4_type)
+            {
+                keys = static_cast<radix_node4 *>(node)->keys;
+                children = static_cast<radix_node4 *>(node)->children;
+            }
+            else
+            {
+                keys = static_cast<radix_node16 *>(node)->keys;
+                children = static_cast<radix_node16 *>(node)->children;
+            }
+            unsigned int i = 0;
+            while (keys[i] != byte)
+                ++i;
+            for (; i + 1 < node->count; ++i)
+            {
+                keys[i] = keys[i + 1];
+                children[i] = children[i + 1];
+            }
+            break;
+        }
+        case radix_node48_type:
+        {
+            radix_node48 *n = static_cast<radix_node48 *>(node);
+            const unsigned int slot = n->index[byte] - 1u;
+            const unsigned int last = n->count - 1u;
+            n->index[byte] = 0;
+            if (slot != last)
+            {
+                n->children[slot] = n->children[last];
+                for (unsigned int b = 0; b < 256; ++b)
+                {
+                    if (n->index[b] == last + 1)
+                    {
+                        n->index[b] = static_cast<unsigned char>(slot + 1);
+                        break;
+                    }
+                }
+            }
+            break;
+        }
+        default:
+            static_cast<radix_node256 *>(node)->children[byte] = NULL;
+            break;
+        }
+        --node->count;
+    }
+
+    // Moves the prefix and children of from into the empty node to
+    inline void radix_move_children(radix_inner *from, radix_inner *to)
+    {
+        to->prefix.swap(from->prefix);
+        unsigned char byte = 0;
+        for (radix_node *child = radix_child_from(from, 0, &byte); child != NULL;
+             child = radix_child_from(from, byte + 1u, &byte))
+            radix_add_child(to, byte, child);
+    }
+
+    template <typename Value, typename Ref, typename Ptr>
+    class radix_map_iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef Value value_type;
+        typedef Ref reference;
+        typedef Ptr pointer;
+        typedef std::ptrdiff_t difference_type;
+        typedef radix_map_iterator<Value, Value &, Value *> non_const_iterator;
+
+    public:
+        radix_map_iterator() : link_(NULL)
+        {
+        }
+
+        explicit radix_map_iterator(radix_link *link) : link_(link)
+        {
+        }
+
+        radix_map_iterator(const non_const_iterator &it) : link_(it.link())
+        {
+        }
+
+    public:
+        reference operator*() const
+        {
+            return static_cast<radix_leaf<Value> *>(link_)->value;
+        }
+
+        pointer operator->() const
+        {
+            return &static_cast<radix_leaf<Value> *>(link_)->value;
+        }
+
+        radix_map_iterator &operator++()
+        {
+            link_ = link_->next;
+            return *this;
+        }
+
+        radix_map_iterator operator++(int)
+        {
+            radix_map_iterator tmp = *this;
+            link_ = link_->next;
+            return tmp;
+        }
+
+        radix_map_iterator &operator--()
+        {
+            link_ = link_->prev;
+            return *this;
+        }
+
+        radix_map_iterator operator--(int)
+        {
+            radix_map_iterator tmp = *this;
+            link_ = link_->prev;
+            return tmp;
+        }
+
+        template <typename R, typename P>
+        bool operator==(const radix_map_iterator<Value, R, P> &other) const
+        {
+            return link_ == other.link();
+        }
+
+        template <typename R, typename P>
+        bool operator!=(const radix_map_iterator<Value, R, P> &other) const
+        {
+            return link_ != other.link();
+        }
+
+        radix_link *link() const
+        {
+            return link_;
+        }
+
+    private:
+        radix_link *link_;
+    };
+
+    template <typename Key, typename T, typename Traits = radix_key_traits<Key>,
+              typename Allocator = std::allocator<pair<const Key, T> > >
+    class radix_map
+    {
+    public:
+        typedef Key                                      key_type;
+        typedef T                                        mapped_type;
+        typedef pair<const key_type, mapped_type>        value_type;
+        typedef Traits                                   key_traits;
+        typedef Allocator                                allocator_type;
+        typedef typename allocator_type::size_type       size_type;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef value_type&                              reference;
+        typedef const value_type&                        const_reference;
+        typedef typename allocator_type::pointer         pointer;
+        typedef typename allocator_type::const_pointer   const_pointer;
+
+        typedef radix_map_iterator<value_type, value_type &, value_type *>             iterator;
+        typedef radix_map_iterator<value_type, const value_type &, const value_type *> const_iterator;
+        typedef ft::reverse_iterator<iterator>                                         reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                                   const_reverse_iterator;
+
+    private:
+        typedef radix_leaf<value_type> leaf_type;
+        typedef typename allocator_type::template rebind<leaf_type>::other     leaf_allocator;
+        typedef typename allocator_type::template rebind<radix_node4>::other   node4_allocator;
+        typedef typename allocator_type::template rebind<radix_node16>::other  node16_allocator;
+        typedef typename allocator_type::template rebind<radix_node48>::other  node48_allocator;
+        typedef typename allocator_type::template rebind<radix_node256>::other node256_allocator;
+
+    public:
+        radix_map()
+            : alloc_(), root_(NULL), header_(), size_(0)
+        {
+        }
+
+        explicit radix_map(const allocator_type &alloc)
+            : alloc_(alloc), root_(NULL), header_(), size_(0)
+        {
+        }
+
+        template <typename InputIt>
+        radix_map(InputIt first, InputIt last, const allocator_type &alloc = allocator_type())
+            : alloc_(alloc), root_(NULL), header_(), size_(0)
+        {
+            insert(first, last);
+        }
+
+        radix_map(const radix_map &other)
+            : alloc_(other.alloc_), root_(NULL), header_(), size_(0)
+        {
+            insert(other.begin(), other.end());
+        }
+
+        radix_map &operator=(const radix_map &other)
+        {
+            if (this != &other)
+            {
+                radix_map tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        ~radix_map()
+        {
+            clear();
+        }
+
+    public:
+        allocator_type get_allocator() const
+        {
+            return alloc_;
+        }
+
+        T &at(const key_type &key)
+        {
+            leaf_type *leaf = find_leaf(key);
+            if (leaf == NULL)
+                throw std::out_of_range("Key not found");
+            return leaf->value.second;
+        }
+
+        const T &at(const key_type &key) const
+        {
+            leaf_type *leaf = find_leaf(key);
+            if (leaf == NULL)
+                throw std::out_of_range("Key not found");
+            return leaf->value.second;
+        }
+
+        T &operator[](const key_type &key)
+        {
+            return insert(ft::make_pair(key, T())).first->second;
+        }
+
+        iterator begin()
+        {
+            return iterator(header_.next);
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(header_.next);
+        }
+
+        iterator end()
+        {
+            return iterator(&header_);
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(header());
+        }
+
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        size_type size() const
+        {
+            return size_;
+        }
+
+        size_type max_size() const
+        {
+            return std::min(leaf_allocator(alloc_).max_size(),
+                            static_cast<size_type>(std::numeric_limits<difference_type>::max()));
+        }
+
+        void clear()
+        {
+            destroy(root_);
+            root_ = NULL;
+            header_.next = &header_;
+            header_.prev = &header_;
+            size_ = 0;
+        }
+
+        pair<iterator, bool> insert(const value_type &value)
+        {
+            std::string key;
+            key_traits::encode(value.first, key);
+
+            if (root_ == NULL)
+            {
+                leaf_type *leaf = create_leaf(value);
+                leaf->link_before(&header_);
+                root_ = leaf;
+                ++size_;
+                return ft::make_pair(iterator(leaf), true);
+            }
+
+            radix_node **ref = &root_;
+            radix_node *greater = NULL; // Nearest subtree right of the path: holds the successor
+            size_type depth = 0;
+            std::string other;
+            while (true)
+            {
+                radix_node *node = *ref;
+                if (node->type == radix_leaf_node)
+                {
+                    leaf_type *leaf = static_cast<leaf_type *>(node);
+                    key_traits::encode(leaf->value.first, other);
+                    if (other == key)
+                        return ft::make_pair(iterator(leaf), false);
+
+                    // Lazy expansion ends here: one Node4 for the bytes both keys share
+                    size_type common = depth;
+                    while (other[common] == key[common])
+                        ++common;
+                    radix_node4 *split = create_node<radix_node4, node4_allocator>();
+                    leaf_type *added = create_leaf(value, split);
+                    split->prefix.assign(key, depth, common - depth);
+                    radix_add_child(split, byte_at(other, common), leaf);
+                    radix_add_child(split, byte_at(key, common), added);
+                    added->link_before(byte_at(key, common) < byte_at(other, common) ? leaf : leaf->next);
+                    *ref = split;
+                    ++size_;
+                    return ft::make_pair(iterator(added), true);
+                }
+
+                radix_inner *inner = static_cast<radix_inner *>(node);
+                const size_type matched = match_prefix(inner, key, depth);
+                if (matched < inner->prefix.size())
+                {
+                    // The key leaves the compressed path: split it where they differ
+                    const unsigned char old_byte = static_cast<unsigned char>(inner->prefix[matched]);
+                    const unsigned char new_byte = byte_at(key, depth + matched);
+                    radix_node4 *split = create_node<radix_node4, node4_allocator>();
+                    leaf_type *added = create_leaf(value, split);
+                    split->prefix.assign(inner->prefix, 0, matched);
+                    inner->prefix.erase(0, matched + 1);
+                    radix_add_child(split, old_byte, inner);
+                    radix_add_child(split, new_byte, added);
+                    if (new_byte < old_byte)
+                        added->link_before(link_of(radix_min_leaf(inner)));
+                    else
+                        added->link_before(link_of(radix_max_leaf(inner))->next);
+                    *ref = split;
+                    ++size_;
+                    return ft::make_pair(iterator(added), true);
+                }
+
+                depth += matched;
+                const unsigned char byte = byte_at(key, depth);
+                radix_node *next = radix_child_from(inner, byte + 1u);
+                if (next != NULL)
+                    greater = next;
+                radix_node **child = radix_find_child(inner, byte);
+                if (child == NULL)
+                {
+                    // Found before add_child, which may replace the node
+                    radix_link *successor = greater == NULL ? &header_ : link_of(radix_min_leaf(greater));
+                    leaf_type *added = create_leaf(value);
+                    try
+                    {
+                        add_child(ref, inner, byte, added);
+                    }
+                    catch (...)
+                    {
+                        destroy_leaf(added);
+                        throw;
+                    }
+                    added->link_before(successor);
+                    ++size_;
+                    return ft::make_pair(iterator(added), true);
+                }
+                ref = child;
+                ++depth;
+            }
+        }
+
+        iterator insert(iterator hint, const value_type &value)
+        {
+            (void)hint;
+            return insert(value).first;
+        }
+
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                insert(*first);
+        }
+
+        void erase(iterator pos)
+        {
+            erase(pos->first);
+        }
+
+        void erase(iterator first, iterator last)
+        {
+            while (first != last)
+                erase(first++);
+        }
+
+        size_type erase(const key_type &key)
+        {
+            std::string encoded;
+            key_traits::encode(key, encoded);
+
+            radix_node **ref = &root_;
+            radix_node **parent_ref = NULL;
+            size_type depth = 0;
+            while (*ref != NULL)
+            {
+                radix_node *node = *ref;
+                if (node->type == radix_leaf_node)
+                {
+                    leaf_type *leaf = static_cast<leaf_type *>(node);
+                    if (!(leaf->value.first == key))
+                        return 0;
+                    if (parent_ref == NULL)
+                        root_ = NULL;
+                    else
+                        remove_child(parent_ref, byte_at(encoded, depth - 1));
+                    leaf->unlink();
+                    destroy_leaf(leaf);
+                    --size_;
+                    return 1;
+                }
+                radix_inner *inner = static_cast<radix_inner *>(node);
+                const size_type matched = match_prefix(inner, encoded, depth);
+                if (matched < inner->prefix.size())
+                    return 0;
+                depth += matched;
+                if (depth == encoded.size())
+                    return 0;
+                radix_node **child = radix_find_child(inner, byte_at(encoded, depth));
+                if (child == NULL)
+                    return 0;
+                parent_ref = ref;
+                ref = child;
+                ++depth;
+            }
+            return 0;
+        }
+
+        void swap(radix_map &other)
+        {
+            std::swap(root_, other.root_);
+            std::swap(size_, other.size_);
+            std::swap(header_, other.header_);
+            relink_header();
+            other.relink_header();
+        }
+
+        size_type count(const key_type &key) const
+        {
+            return find_leaf(key) == NULL ? 0 : 1;
+        }
+
+        iterator find(const key_type &key)
+        {
+            leaf_type *leaf = find_leaf(key);
+            return leaf == NULL ? end() : iterator(leaf);
+        }
+
+        const_iterator find(const key_type &key) const
+        {
+            leaf_type *leaf = find_leaf(key);
+            return leaf == NULL ? end() : const_iterator(leaf);
+        }
+
+        iterator lower_bound(const key_type &key)
+        {
+            std::string encoded;
+            key_traits::encode(key, encoded);
+            return iterator(lower_bound_link(encoded));
+        }
+
+        const_iterator lower_bound(const key_type &key) const
+        {
+            std::string encoded;
+            key_traits::encode(key, encoded);
+            return const_iterator(lower_bound_link(encoded));
+        }
+
+        iterator upper_bound(const key_type &key)
+        {
+            iterator it = lower_bound(key);
+            if (it != end() && it->first == key)
+                ++it;
+            return it;
+        }
+
+        const_iterator upper_bound(const key_type &key) const
+        {
+            const_iterator it = lower_bound(key);
+            if (it != end() && it->first == key)
+                ++it;
+            return it;
+        }
+
+        pair<iterator, iterator> equal_range(const key_type &key)
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        pair<const_iterator, const_iterator> equal_range(const key_type &key) const
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        // Every element whose key starts with prefix, as encoded by key_traits::encode_prefix
+        pair<iterator, iterator> prefix_range(const key_type &prefix)
+        {
+            pair<radix_link *, radix_link *> range = prefix_links(prefix);
+            return ft::make_pair(iterator(range.first), iterator(range.second));
+        }
+
+        pair<const_iterator, const_iterator> prefix_range(const key_type &prefix) const
+        {
+            pair<radix_link *, radix_link *> range = prefix_links(prefix);
+            return ft::make_pair(const_iterator(range.first), const_iterator(range.second));
+        }
+
+    private:
+        static unsigned char byte_at(const std::string &bytes, size_type i)
+        {
+            return static_cast<unsigned char>(bytes[i]);
+        }
+
+        static radix_link *link_of(radix_node *leaf)
+        {
+            return static_cast<leaf_type *>(leaf);
+        }
+
+        radix_link *header() const
+        {
+            return const_cast<radix_link *>(&header_);
+        }
+
+        // The header moved (swap): point the ends of the leaf list back at it
+        void relink_header()
+        {
+            if (size_ == 0)
+            {
+                header_.next = &header_;
+                header_.prev = &header_;
+                return;
+            }
+            header_.next->prev = &header_;
+            header_.prev->next = &header_;
+        }
+
+        // Bytes of the node's prefix that key matches from depth on
+        static size_type match_prefix(const radix_inner *node, const std::string &key, size_type depth)
+        {
+            const size_type limit = std::min(node->prefix.size(), key.size() - std::min(depth, key.size()));
+            size_type i = 0;
+            while (i < limit && node->prefix[i] == key[depth + i])
+                ++i;
+            return i;
+        }
+
+        leaf_type *find_leaf(const key_type &key) const
+        {
+            std::string encoded;
+            key_traits::encode(key, encoded);
+
+            radix_node *node = root_;
+            size_type depth = 0;
+            while (node != NULL)
+            {
+                if (node->type == radix_leaf_node)
+                {
+                    leaf_type *leaf = static_cast<leaf_type *>(node);
+                    return leaf->value.first == key ? leaf : NULL;
+                }
+                radix_inner *inner = static_cast<radix_inner *>(node);
+                if (match_prefix(inner, encoded, depth) < inner->prefix.size())
+                    return NULL;
+                depth += inner->prefix.size();
+                if (depth == encoded.size())
+                    return NULL;
+                radix_node **child = radix_find_child(inner, byte_at(encoded, depth));
+                node = child == NULL ? NULL : *child;
+                ++depth;
+            }
+            return NULL;
+        }
+
+        // First leaf whose encoded key is not less than bytes (which may be a bare prefix)
+        radix_link *lower_bound_link(const std::string &bytes) const
+        {
+            radix_node *node = root_;
+            size_type depth = 0;
+            std::string other;
+            if (node == NULL)
+                return header();
+            while (true)
+            {
+                if (node->type == radix_leaf_node)
+                {
+                    leaf_type *leaf = static_cast<leaf_type *>(node);
+                    key_traits::encode(leaf->value.first, other);
+                    return other < bytes ? leaf->next : leaf;
+                }
+                radix_inner *inner = static_cast<radix_inner *>(node);
+                const size_type matched = match_prefix(inner, bytes, depth);
+                if (matched < inner->prefix.size())
+                {
+                    // Either bytes ran out (everything below extends it) or the paths split
+                    if (depth + matched == bytes.size()
+                        || byte_at(inner->prefix, matched) > byte_at(bytes, depth + matched))
+                        return link_of(radix_min_leaf(node));
+                    return link_of(radix_max_leaf(node))->next;
+                }
+                depth += matched;
+                if (depth == bytes.size())
+                    return link_of(radix_min_leaf(node));
+                const unsigned char byte = byte_at(bytes, depth);
+                radix_node **child = radix_find_child(inner, byte);
+                if (child == NULL)
+                {
+                    radix_node *next = radix_child_from(inner, byte + 1u);
+                    return next != NULL ? link_of(radix_min_leaf(next)) : link_of(radix_max_leaf(node))->next;
+                }
+                node = *child;
+                ++depth;
+            }
+        }
+
+        pair<radix_link *, radix_link *> prefix_links(const key_type &prefix) const
+        {
+            std::string bytes;
+            key_traits::encode_prefix(prefix, bytes);
+            radix_link *first = lower_bound_link(bytes);
+
+            // The range ends at the first key above every extension: bump the last byte below 0xff
+            while (!bytes.empty() && byte_at(bytes, bytes.size() - 1) == 0xff)
+                bytes.erase(bytes.size() - 1);
+            if (bytes.empty())
+                return ft::make_pair(first, header());
+            bytes[bytes.size() - 1] = static_cast<char>(byte_at(bytes, bytes.size() - 1) + 1);
+            return ft::make_pair(first, lower_bound_link(bytes));
+        }
+
+        // Adds a child to *ref, first moving it to the next node size when it is full
+        void add_child(radix_node **ref, radix_inner *node, unsigned char byte, radix_node *child)
+        {
+            if (node->count == radix_capacity(node))
+            {
+                radix_inner *bigger;
+                if (node->type == radix_node4_type)
+                    bigger = create_node<radix_node16, node16_allocator>();
+                else if (node->type == radix_node16_type)
+                    bigger = create_node<radix_node48, node48_allocator>();
+                else
+                    bigger = create_node<radix_node256, node256_allocator>();
+                radix_move_children(node, bigger);
+                destroy_inner(node);
+                *ref = bigger;
+                node = bigger;
+            }
+            radix_add_child(node, byte, child);
+        }
+
+        /**
+         * @brief Removes a child of *ref, then shrinks the node when it got sparse (with some
+         * slack under the growth points, so alternating inserts and erases do not thrash) or
+         * merges a Node4 left with one child into that child.
+         */
+        void remove_child(radix_node **ref, unsigned char byte)
+        {
+            radix_inner *node = static_cast<radix_inner *>(*ref);
+            radix_remove_child(node, byte);
+
+            radix_inner *smaller = NULL;
+            if (node->type == radix_node4_type && node->count == 1)
+            {
+                unsigned char only_byte = 0;
+                radix_node *only = radix_child_from(node, 0, &only_byte);
+                if (only->type != radix_leaf_node)
+                {
+                    radix_inner *below = static_cast<radix_inner *>(only);
+                    std::string merged;
+                    merged.reserve(node->prefix.size() + 1 + below->prefix.size());
+                    merged.append(node->prefix);
+                    merged += static_cast<char>(only_byte);
+                    merged.append(below->prefix);
+                    below->prefix.swap(merged);
+                }
+                destroy_inner(node);
+                *ref = only;
+                return;
+            }
+            if (node->type == radix_node16_type && node->count <= 3)
+                smaller = create_node<radix_node4, node4_allocator>();
+            else if (node->type == radix_node48_type && node->count <= 12)
+                smaller = create_node<radix_node16, node16_allocator>();
+            else if (node->type == radix_node256_type && node->count <= 37)
+                smaller = create_node<radix_node48, node48_allocator>();
+            if (smaller != NULL)
+            {
+                radix_move_children(node, smaller);
+                destroy_inner(node);
+                *ref = smaller;
+            }
+        }
+
+        template <typename Node, typename NodeAllocator>
+        Node *create_node()
+        {
+            NodeAllocator alloc(alloc_);
+            Node *node = alloc.allocate(1);
+            try
+            {
+                alloc.construct(node, Node());
+            }
+            catch (...)
+            {
+                alloc.deallocate(node, 1);
+                throw;
+            }
+            return node;
+        }
+
+        template <typename Node, typename NodeAllocator>
+        void destroy_node(radix_inner *node)
+        {
+            NodeAllocator alloc(alloc_);
+            Node *typed = static_cast<Node *>(node);
+            alloc.destroy(typed);
+            alloc.deallocate(typed, 1);
+        }
+
+        void destroy_inner(radix_inner *node)
+        {
+            switch (node->type)
+            {
+            case radix_node4_type:
+                destroy_node<radix_node4, node4_allocator>(node);
+                break;
+            case radix_node16_type:
+                destroy_node<radix_node16, node16_allocator>(node);
+                break;
+            case radix_node48_type:
+                destroy_node<radix_node48, node48_allocator>(node);
+                break;
+            default:
+                destroy_node<radix_node256, node256_allocator>(node);
+                break;
+            }
+        }
+
+        // On failure, also frees the node made for the leaf to go in
+        leaf_type *create_leaf(const value_type &value, radix_inner *pending = NULL)
+        {
+            leaf_allocator alloc(alloc_);
+            leaf_type *leaf = NULL;
+            try
+            {
+                leaf = alloc.allocate(1);
+                alloc.construct(leaf, leaf_type(value));
+            }
+            catch (...)
+            {
+                if (leaf != NULL)
+                    alloc.deallocate(leaf, 1);
+                if (pending != NULL)
+                    destroy_inner(pending);
+                throw;
+            }
+            return leaf;
+        }
+
+        void destroy_leaf(leaf_type *leaf)
+        {
+            leaf_allocator alloc(alloc_);
+            alloc.destroy(leaf);
+            alloc.deallocate(leaf, 1);
+        }
+
+        void destroy(radix_node *node)
+        {
+            if (node == NULL)
+                return;
+            if (node->type == radix_leaf_node)
+            {
+                destroy_leaf(static_cast<leaf_type *>(node));
+                return;
+            }
+            radix_inner *inner = static_cast<radix_inner *>(node);
+            unsigned char byte = 0;
+            for (radix_node *child = radix_child_from(inner, 0, &byte); child != NULL;
+                 child = radix_child_from(inner, byte + 1u, &byte))
+                destroy(child);
+            destroy_inner(inner);
+        }
+
+    private:
+        allocator_type alloc_;
+        radix_node *root_;
+        radix_link header_; // Sentinel of the leaf list, end()
+        size_type size_;
+    };
+
+    template <typename Key, typename T, typename Traits, typename Allocator>
+    inline void swap(radix_map<Key, T, Traits, Allocator> &x, radix_map<Key, T, Traits, Allocator> &y)
+    {
+        x.swap(y);
+    }
+
+    template <typename Key, typename T, typename Traits, typename Allocator>
+    inline bool operator==(const radix_map<Key, T, Traits, Allocator> &lhs,
+                           const radix_map<Key, T, Traits, Allocator> &rhs)
+    {
+        return (lhs.size() == rhs.size()) && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename Key, typename T, typename Traits, typename Allocator>
+    inline bool operator!=(const radix_map<Key, T, Traits, Allocator> &lhs,
+                           const radix_map<Key, T, Traits, Allocator> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    namespace pmr
+    {
+        // ft::radix_map allocating from a memory_resource
+        template <typename Key, typename T, typename Traits = radix_key_traits<Key> >
+        struct radix_map
+        {
+            typedef ft::radix_map<Key, T, Traits, polymorphic_allocator<pair<const Key, T> > > type;
+        };
+    } // namespace pmr
+} // namespace ft
+
+#endif
\ No newline at end of file
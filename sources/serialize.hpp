@@ -0,0 +1,461 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   serialize.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:12:40 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 17:12:40 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SERIALIZE_HPP
+# define SERIALIZE_HPP
+
+# include <cerrno>
+# include <cstddef>
+# include <cstring>
+# include <iterator>
+# include <stdexcept>
+
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+
+# include "hash.hpp"
+# include "map.hpp"
+# include "random_access_iterator.hpp"
+# include "tree_access.hpp"
+# include "type_trait.hpp"
+# include "vector.hpp"
+
+/**
+ * @brief Binary snapshots of ft::map and ft::vector, for element types that can be copied byte
+ * by byte. A snapshot is a 64-byte header (magic, format version, byte order, element sizes,
+ * count, FNV-1a checksum of the payload) followed by the raw elements: key bytes then value bytes
+ * for each map element in order, the array itself for a vector.
+ *
+ * Loading never re-inserts: a map is rebuilt from the sorted records in O(n) by
+ * tree::assign_sorted, and a vector is read straight into its storage or, with mapped_vector,
+ * not read at all but mapped from the file. Snapshots are only portable between builds with
+ * the same type layouts and byte order, which the header checks.
+ *
+ * Loading a map replaces its elements only: an enabled lookup cache or Bloom filter stays enabled
+ * (the filter is rebuilt for the new keys). The element count in the header is checked against
+ * the size of the file before anything is allocated.
+ *
+ * Errors (I/O, truncated or corrupt files, mismatching types) throw std::runtime_error and leave
+ * the destination untouched.
+ *
+ * @link https://man7.org/linux/man-pages/man2/mmap.2.html @endlink
+ * @link http://www.isthe.com/chongo/tech/comp/fnv/ @endlink
+ */
+
+namespace ft
+{
+    enum snapshot_kind
+    {
+        snapshot_map = 1,
+        snapshot_vector = 2
+    };
+
+    struct snapshot_header
+    {
+        char magic[8];
+        unsigned int version;
+        unsigned int byte_order; // snapshot_byte_order as written by the saving machine
+        unsigned int kind;
+        unsigned int key_size;   // 0 for vectors
+        unsigned int value_size;
+        unsigned int reserved;
+        unsigned long long count;
+        unsigned long long checksum;
+        char padding[16]; // Keeps the payload 64-byte aligned in a mapping
+    };
+
+    static const char snapshot_magic[8] = {'F', 'T', 'S', 'N', 'A', 'P', '\0', '\0'};
+    static const unsigned int snapshot_version = 1;
+    static const unsigned int snapshot_byte_order = 0x01020304;
+
+    inline void snapshot_write(int fd, const void *data, std::size_t len)
+    {
+        const char *p = static_cast<const char *>(data);
+        while (len != 0)
+        {
+            ssize_t n = ::write(fd, p, len);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                throw std::runtime_error("snapshot: write failed");
+            p += n;
+            len -= static_cast<std::size_t>(n);
+        }
+    }
+
+    inline void snapshot_read(int fd, void *data, std::size_t len)
+    {
+        char *p = static_cast<char *>(data);
+        while (len != 0)
+        {
+            ssize_t n = ::read(fd, p, len);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n < 0)
+                throw std::runtime_error("snapshot: read failed");
+            if (n == 0)
+                throw std::runtime_error("snapshot: truncated file");
+            p += n;
+            len -= static_cast<std::size_t>(n);
+        }
+    }
+
+    inline snapshot_header snapshot_make_header(snapshot_kind kind, std::size_t key_size, std::size_t value_size,
+                                                std::size_t count, unsigned long long checksum)
+    {
+        snapshot_header header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+        header.version = snapshot_version;
+        header.byte_order = snapshot_byte_order;
+        header.kind = kind;
+        header.key_size = static_cast<unsigned int>(key_size);
+        header.value_size = static_cast<unsigned int>(value_size);
+        header.count = count;
+        header.checksum = checksum;
+        return header;
+    }
+
+    // Throws unless header describes a snapshot of this kind and these element sizes
+    inline void snapshot_check_header(const snapshot_header &header, snapshot_kind kind,
+                                      std::size_t key_size, std::size_t value_size)
+    {
+        if (std::memcmp(header.magic, snapshot_magic, sizeof(header.magic)) != 0)
+            throw std::runtime_error("snapshot: not a snapshot file");
+        if (header.version != snapshot_version)
+            throw std::runtime_error("snapshot: unsupported format version");
+        if (header.byte_order != snapshot_byte_order)
+            throw std::runtime_error("snapshot: written with another byte order");
+        if (header.kind != static_cast<unsigned int>(kind))
+            throw std::runtime_error("snapshot: wrong container kind");
+        if (header.key_size != key_size || header.value_size != value_size)
+            throw std::runtime_error("snapshot: element type does not match");
+        const std::size_t record = key_size + value_size;
+        if (header.count > static_cast<unsigned long long>(static_cast<std::size_t>(-1) / record))
+            throw std::runtime_error("snapshot: element count out of range");
+    }
+
+    // Throws unless a regular file has at least len bytes left after the current offset. Pipes
+    // and sockets have no known size, snapshot_read_elements bounds what they can make us allocate.
+    inline void snapshot_check_remaining(int fd, std::size_t len)
+    {
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+            throw std::runtime_error("snapshot: cannot stat file");
+        if (!S_ISREG(st.st_mode))
+            return;
+        off_t pos = ::lseek(fd, 0, SEEK_CUR);
+        if (pos < 0 || pos > st.st_size
+            || static_cast<unsigned long long>(st.st_size - pos) < static_cast<unsigned long long>(len))
+            throw std::runtime_error("snapshot: truncated file");
+    }
+
+    // Reads count elements of out's type, growing out a chunk at a time: a corrupt count runs into
+    // the end of the data before it gets the memory it asks for
+    template <typename Vector>
+    void snapshot_read_elements(int fd, Vector &out, std::size_t count)
+    {
+        typedef typename Vector::value_type value_type;
+        snapshot_check_remaining(fd, count * sizeof(value_type));
+        const std::size_t chunk = sizeof(value_type) >= (1 << 20) ? 1 : (1 << 20) / sizeof(value_type);
+        while (out.size() < count)
+        {
+            const std::size_t done = out.size();
+            const std::size_t n = count - done < chunk ? count - done : chunk;
+            out.resize(done + n);
+            snapshot_read(fd, out.data() + done, n * sizeof(value_type));
+        }
+    }
+
+    // Reads map records (key bytes, then value bytes) out of a checked payload
+    template <typename Key, typename T>
+    class snapshot_record_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef pair<const Key, T>        value_type;
+        typedef std::ptrdiff_t            difference_type;
+        typedef const value_type         *pointer;
+        typedef value_type                reference;
+
+        static const std::size_t record_size = sizeof(Key) + sizeof(T);
+
+    public:
+        explicit snapshot_record_iterator(const char *record) : record_(record)
+        {
+        }
+
+        Key key() const
+        {
+            Key key;
+            std::memcpy(&key, record_, sizeof(Key));
+            return key;
+        }
+
+        reference operator*() const
+        {
+            T value;
+            std::memcpy(&value, record_ + sizeof(Key), sizeof(T));
+            return value_type(key(), value);
+        }
+
+        snapshot_record_iterator &operator++()
+        {
+            record_ += record_size;
+            return *this;
+        }
+
+        snapshot_record_iterator operator++(int)
+        {
+            snapshot_record_iterator tmp = *this;
+            record_ += record_size;
+            return tmp;
+        }
+
+        bool operator==(const snapshot_record_iterator &other) const
+        {
+            return record_ == other.record_;
+        }
+
+        bool operator!=(const snapshot_record_iterator &other) const
+        {
+            return record_ != other.record_;
+        }
+
+    private:
+        const char *record_;
+    };
+
+    template <typename Key, typename T, typename Compare, typename Allocator, typename Balance>
+    typename enable_if<is_trivially_copyable<Key>::value && is_trivially_copyable<T>::value>::type
+    save(const map<Key, T, Compare, Allocator, Balance> &m, int fd)
+    {
+        typedef typename map<Key, T, Compare, Allocator, Balance>::const_iterator const_iterator;
+
+        // The checksum goes in the header, so it is computed by a first pass over the map
+        unsigned long long checksum = hash_bytes(NULL, 0);
+        for (const_iterator it = m.begin(); it != m.end(); ++it)
+        {
+            checksum = hash_bytes(&it->first, sizeof(Key), checksum);
+            checksum = hash_bytes(&it->second, sizeof(T), checksum);
+        }
+        snapshot_header header = snapshot_make_header(snapshot_map, sizeof(Key), sizeof(T), m.size(), checksum);
+        snapshot_write(fd, &header, sizeof(header));
+
+        const std::size_t record = sizeof(Key) + sizeof(T);
+        const std::size_t buffer_records = (65536 + record - 1) / record;
+        vector<char> buffer(buffer_records * record);
+        std::size_t used = 0;
+        for (const_iterator it = m.begin(); it != m.end(); ++it)
+        {
+            std::memcpy(buffer.data() + used, &it->first, sizeof(Key));
+            std::memcpy(buffer.data() + used + sizeof(Key), &it->second, sizeof(T));
+            used += record;
+            if (used == buffer.size())
+            {
+                snapshot_write(fd, buffer.data(), used);
+                used = 0;
+            }
+        }
+        snapshot_write(fd, buffer.data(), used);
+    }
+
+    template <typename Key, typename T, typename Compare, typename Allocator, typename Balance>
+    typename enable_if<is_trivially_copyable<Key>::value && is_trivially_copyable<T>::value>::type
+    load(map<Key, T, Compare, Allocator, Balance> &m, int fd)
+    {
+        typedef snapshot_record_iterator<Key, T> record_iterator;
+
+        snapshot_header header;
+        snapshot_read(fd, &header, sizeof(header));
+        snapshot_check_header(header, snapshot_map, sizeof(Key), sizeof(T));
+
+        const std::size_t size = static_cast<std::size_t>(header.count) * record_iterator::record_size;
+        vector<char> payload;
+        snapshot_read_elements(fd, payload, size);
+        if (hash_bytes(payload.data(), size) != header.checksum)
+            throw std::runtime_error("snapshot: checksum mismatch");
+
+        record_iterator first(payload.data());
+        record_iterator last(payload.data() + size);
+
+        // assign_sorted trusts its input; a file saved under another ordering must not get there
+        Compare comp = m.key_comp();
+        if (first != last)
+        {
+            record_iterator prev = first;
+            for (record_iterator it = ++record_iterator(first); it != last; prev = it, ++it)
+                if (!comp(prev.key(), it.key()))
+                    throw std::runtime_error("snapshot: keys are not sorted for this comparator");
+        }
+
+        tree_access::replace_sorted(m, first, last);
+    }
+
+    template <typename T, typename Allocator>
+    typename enable_if<is_trivially_copyable<T>::value>::type
+    save(const vector<T, Allocator> &v, int fd)
+    {
+        const std::size_t size = v.size() * sizeof(T);
+        snapshot_header header = snapshot_make_header(snapshot_vector, 0, sizeof(T), v.size(),
+                                                      hash_bytes(v.data(), size));
+        snapshot_write(fd, &header, sizeof(header));
+        snapshot_write(fd, v.data(), size);
+    }
+
+    template <typename T, typename Allocator>
+    typename enable_if<is_trivially_copyable<T>::value>::type
+    load(vector<T, Allocator> &v, int fd)
+    {
+        snapshot_header header;
+        snapshot_read(fd, &header, sizeof(header));
+        snapshot_check_header(header, snapshot_vector, 0, sizeof(T));
+
+        const std::size_t count = static_cast<std::size_t>(header.count);
+        vector<T, Allocator> tmp(v.get_allocator());
+        snapshot_read_elements(fd, tmp, count);
+        if (hash_bytes(tmp.data(), count * sizeof(T)) != header.checksum)
+            throw std::runtime_error("snapshot: checksum mismatch");
+        v.swap(tmp);
+    }
+
+    /**
+     * @brief Read-only array view of a vector snapshot, mapped from the file instead of read:
+     * opening costs one mmap, and pages are only loaded when touched. Verification (on by
+     * default) reads the whole payload once to check the checksum. The view owns the mapping; the
+     * file descriptor may be closed after construction.
+     */
+    template <typename T>
+    class mapped_vector
+    {
+    public:
+        typedef typename enable_if<is_trivially_copyable<T>::value, T>::type value_type;
+        typedef std::size_t                                               size_type;
+        typedef std::ptrdiff_t                                            difference_type;
+        typedef const value_type&                                         const_reference;
+        typedef const value_type*                                         const_pointer;
+        typedef const_reference                                           reference;
+        typedef const_pointer                                             pointer;
+        typedef random_access_iterator<const_pointer, mapped_vector>      const_iterator;
+        typedef const_iterator                                            iterator;
+        typedef ft::reverse_iterator<const_iterator>                      const_reverse_iterator;
+
+    public:
+        explicit mapped_vector(int fd, bool verify = true)
+            : base_(MAP_FAILED), length_(0), data_(NULL), size_(0)
+        {
+            struct stat st;
+            if (::fstat(fd, &st) != 0)
+                throw std::runtime_error("snapshot: cannot stat file");
+            if (st.st_size < static_cast<off_t>(sizeof(snapshot_header)))
+                throw std::runtime_error("snapshot: truncated file");
+            length_ = static_cast<std::size_t>(st.st_size);
+            base_ = ::mmap(NULL, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (base_ == MAP_FAILED)
+                throw std::runtime_error("snapshot: mmap failed");
+
+            try
+            {
+                snapshot_header header;
+                std::memcpy(&header, base_, sizeof(header));
+                snapshot_check_header(header, snapshot_vector, 0, sizeof(T));
+                size_ = static_cast<size_type>(header.count);
+                if (size_ > (length_ - sizeof(header)) / sizeof(T))
+                    throw std::runtime_error("snapshot: truncated file");
+                data_ = reinterpret_cast<const_pointer>(static_cast<const char *>(base_) + sizeof(header));
+                if (verify && hash_bytes(data_, size_ * sizeof(T)) != header.checksum)
+                    throw std::runtime_error("snapshot: checksum mismatch");
+            }
+            catch (...)
+            {
+                ::munmap(base_, length_);
+                throw;
+            }
+        }
+
+        ~mapped_vector()
+        {
+            ::munmap(base_, length_);
+        }
+
+    public:
+        const_iterator begin() const
+        {
+            return const_iterator(data_);
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(data_ + size_);
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        const_reference operator[](size_type pos) const
+        {
+            return data_[pos];
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos >= size_)
+                throw std::out_of_range("Index is out of mapped_vector range");
+            return data_[pos];
+        }
+
+        const_reference front() const
+        {
+            return data_[0];
+        }
+
+        const_reference back() const
+        {
+            return data_[size_ - 1];
+        }
+
+        const_pointer data() const
+        {
+            return data_;
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        size_type size() const
+        {
+            return size_;
+        }
+
+    private:
+        mapped_vector(const mapped_vector &);
+        mapped_vector &operator=(const mapped_vector &);
+
+    private:
+        void *base_;
+        std::size_t length_;
+        const_pointer data_;
+        size_type size_;
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,327 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sharded_map.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:48:02 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 10:48:02 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SHARDED_MAP_HPP
+# define SHARDED_MAP_HPP
+
+# include <functional>
+
+# include "atomic.hpp"
+# include "hash.hpp"
+# include "map.hpp"
+# include "mutex.hpp"
+# include "node_pool.hpp"
+
+/**
+ * @brief Map for write-heavy multi-threaded workloads. Keys are hash-partitioned over `Shards`
+ * independent ft::map instances; each shard has its own lock and its own node pool, and is padded
+ * to a cache line so that threads working on different shards never share one.
+ *
+ * Point operations lock a single shard. Ordered traversal goes through an ordered_view, which locks
+ * every shard and merges their (already sorted) sequences.
+ *
+ * @link https://en.wikipedia.org/wiki/Lock_(computer_science)#Granularity @endlink
+ * @link https://en.wikipedia.org/wiki/False_sharing @endlink
+ */
+
+namespace ft
+{
+    template <typename Key, typename T, std::size_t Shards = 16,
+              typename Compare = std::less<Key>, typename Hash = ft::hash<Key> >
+    class sharded_map
+    {
+    public:
+        typedef Key                                         key_type;
+        typedef T                                           mapped_type;
+        typedef pair<const key_type, mapped_type>           value_type;
+        typedef Compare                                     key_compare;
+        typedef Hash                                        hasher;
+        typedef pool_allocator<value_type>                  allocator_type;
+        typedef map<key_type, mapped_type, key_compare, allocator_type> shard_map_type;
+        typedef typename shard_map_type::size_type          size_type;
+        typedef typename shard_map_type::const_iterator     shard_iterator;
+
+    private:
+        struct shard
+        {
+            mutex lock;
+            node_pool pool;
+            shard_map_type map;
+            char pad[FT_CACHE_LINE_SIZE];
+
+            shard()
+                : lock(), pool(), map(key_compare(), allocator_type(&pool))
+            {
+            }
+
+            // Arrays are default-constructed, so the owner's comparator is installed afterwards
+            void init(const key_compare &comp)
+            {
+                shard_map_type(comp, allocator_type(&pool)).swap(map);
+            }
+        };
+
+    public:
+        /**
+         * @brief Sorted view over all shards. Every shard stays locked while the view lives, so
+         * keep it short. The iterator is a k-way merge: it remembers the position in every shard
+         * and always yields the smallest head.
+         */
+        class ordered_view
+        {
+        public:
+            class const_iterator
+            {
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef typename sharded_map::value_type value_type;
+                typedef const value_type &reference;
+                typedef const value_type *pointer;
+                typedef std::ptrdiff_t difference_type;
+
+            public:
+                const_iterator()
+                    : comp_(), pick_(Shards)
+                {
+                }
+
+                reference operator*() const
+                {
+                    return *cur_[pick_];
+                }
+
+                pointer operator->() const
+                {
+                    return &(operator*());
+                }
+
+                const_iterator &operator++()
+                {
+                    ++cur_[pick_];
+                    select();
+                    return *this;
+                }
+
+                const_iterator operator++(int)
+                {
+                    const_iterator tmp = *this;
+                    ++(*this);
+                    return tmp;
+                }
+
+                bool operator==(const const_iterator &other) const
+                {
+                    if (pick_ != other.pick_)
+                        return false;
+                    return pick_ == Shards || cur_[pick_] == other.cur_[pick_];
+                }
+
+                bool operator!=(const const_iterator &other) const
+                {
+                    return !(*this == other);
+                }
+
+            private:
+                friend class ordered_view;
+
+                void select()
+                {
+                    pick_ = Shards;
+                    for (std::size_t i = 0; i < Shards; ++i)
+                    {
+                        if (cur_[i] == end_[i])
+                            continue;
+                        if (pick_ == Shards || comp_(cur_[i]->first, cur_[pick_]->first))
+                            pick_ = i;
+                    }
+                }
+
+            private:
+                key_compare comp_;
+                shard_iterator cur_[Shards];
+                shard_iterator end_[Shards];
+                std::size_t pick_;
+            };
+
+        public:
+            explicit ordered_view(sharded_map &owner)
+                : owner_(owner)
+            {
+                // Always in index order, so two views can never deadlock
+                for (std::size_t i = 0; i < Shards; ++i)
+                    owner_.shards_[i].lock.lock();
+            }
+
+            ~ordered_view()
+            {
+                for (std::size_t i = Shards; i > 0; --i)
+                    owner_.shards_[i - 1].lock.unlock();
+            }
+
+        public:
+            const_iterator begin() const
+            {
+                const_iterator it;
+                for (std::size_t i = 0; i < Shards; ++i)
+                {
+                    it.cur_[i] = shard_at(i).begin();
+                    it.end_[i] = shard_at(i).end();
+                }
+                it.comp_ = owner_.comp_;
+                it.select();
+                return it;
+            }
+
+            const_iterator end() const
+            {
+                return const_iterator();
+            }
+
+            const_iterator lower_bound(const key_type &key) const
+            {
+                const_iterator it;
+                for (std::size_t i = 0; i < Shards; ++i)
+                {
+                    it.cur_[i] = shard_at(i).lower_bound(key);
+                    it.end_[i] = shard_at(i).end();
+                }
+                it.comp_ = owner_.comp_;
+                it.select();
+                return it;
+            }
+
+            size_type size() const
+            {
+                size_type total = 0;
+                for (std::size_t i = 0; i < Shards; ++i)
+                    total += shard_at(i).size();
+                return total;
+            }
+
+        private:
+            ordered_view(const ordered_view &);
+            ordered_view &operator=(const ordered_view &);
+
+            const shard_map_type &shard_at(std::size_t i) const
+            {
+                return owner_.shards_[i].map;
+            }
+
+        private:
+            sharded_map &owner_;
+        };
+
+        friend class ordered_view;
+
+    public:
+        explicit sharded_map(const key_compare &comp = key_compare(), const hasher &hash = hasher())
+            : comp_(comp), hash_(hash)
+        {
+            for (std::size_t i = 0; i < Shards; ++i)
+                shards_[i].init(comp_);
+        }
+
+    public:
+        // Returns false when the key was already there
+        bool insert(const value_type &value)
+        {
+            shard &s = shard_for(value.first);
+            lock_guard<mutex> guard(s.lock);
+            return s.map.insert(value).second;
+        }
+
+        void assign(const key_type &key, const mapped_type &value)
+        {
+            shard &s = shard_for(key);
+            lock_guard<mutex> guard(s.lock);
+            s.map[key] = value;
+        }
+
+        size_type erase(const key_type &key)
+        {
+            shard &s = shard_for(key);
+            lock_guard<mutex> guard(s.lock);
+            return s.map.erase(key);
+        }
+
+        bool find(const key_type &key, mapped_type &out)
+        {
+            shard &s = shard_for(key);
+            lock_guard<mutex> guard(s.lock);
+            typename shard_map_type::iterator it = s.map.find(key);
+            if (it == s.map.end())
+                return false;
+            out = it->second;
+            return true;
+        }
+
+        size_type count(const key_type &key)
+        {
+            shard &s = shard_for(key);
+            lock_guard<mutex> guard(s.lock);
+            return s.map.count(key);
+        }
+
+        // Shards are locked one after the other, so the total is not a snapshot
+        size_type size()
+        {
+            size_type total = 0;
+            for (std::size_t i = 0; i < Shards; ++i)
+            {
+                lock_guard<mutex> guard(shards_[i].lock);
+                total += shards_[i].map.size();
+            }
+            return total;
+        }
+
+        bool empty()
+        {
+            return size() == 0;
+        }
+
+        void clear()
+        {
+            for (std::size_t i = 0; i < Shards; ++i)
+            {
+                lock_guard<mutex> guard(shards_[i].lock);
+                shards_[i].map.clear();
+            }
+        }
+
+        std::size_t shard_index(const key_type &key) const
+        {
+            return hash_(key) % Shards;
+        }
+
+        key_compare key_comp() const
+        {
+            return comp_;
+        }
+
+    private:
+        sharded_map(const sharded_map &);
+        sharded_map &operator=(const sharded_map &);
+
+        shard &shard_for(const key_type &key)
+        {
+            return shards_[shard_index(key)];
+        }
+
+    private:
+        key_compare comp_;
+        hasher hash_;
+        char pad_[FT_CACHE_LINE_SIZE];
+        shard shards_[Shards];
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,207 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spsc_queue.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:31:08 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 14:31:08 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SPSC_QUEUE_HPP
+# define SPSC_QUEUE_HPP
+
+# include <cstddef>
+# include <memory>
+# include <stdexcept>
+
+# include "atomic.hpp"
+
+/**
+ * @brief Bounded FIFO for exactly one producer thread and one consumer thread, on a power-of-two
+ * ring. No CAS and no lock: each side owns one index and publishes it with a release store.
+ *
+ * The two indices sit on separate cache lines, and each side keeps a private copy of the other
+ * side's index, refreshed only when the ring looks full (producer) or empty (consumer). In
+ * steady state a push or pop therefore touches no cache line written by the other thread
+ * except the slot itself.
+ *
+ * push_n and pop_n move up to `count` elements and publish the index once for the whole batch.
+ *
+ * @link https://rigtorp.se/ringbuffer/ @endlink
+ * @link https://www.1024cores.net/home/lock-free-algorithms/queues @endlink
+ */
+
+namespace ft
+{
+    template <typename T, typename Allocator = std::allocator<T> >
+    class spsc_queue
+    {
+    public:
+        typedef T           value_type;
+        typedef Allocator   allocator_type;
+        typedef std::size_t size_type;
+
+    public:
+        // capacity is rounded up to a power of two
+        explicit spsc_queue(size_type capacity, const allocator_type &alloc = allocator_type())
+            : tail_(0), cached_head_(0), head_(0), cached_tail_(0), alloc_(alloc),
+              capacity_(round_up(capacity)), mask_(capacity_ - 1), slots_(alloc_.allocate(capacity_))
+        {
+        }
+
+        // Not thread-safe: neither side may use the queue any more
+        ~spsc_queue()
+        {
+            for (size_type i = head_; i != tail_; ++i)
+                alloc_.destroy(&slots_[i & mask_]);
+            alloc_.deallocate(slots_, capacity_);
+        }
+
+    public:
+        // Producer only; false when full
+        bool try_push(const value_type &value)
+        {
+            const size_type t = tail_;
+            if (t - cached_head_ == capacity_)
+            {
+                cached_head_ = atomic_load(&head_);
+                if (t - cached_head_ == capacity_)
+                    return false;
+            }
+            alloc_.construct(&slots_[t & mask_], value);
+            atomic_store(&tail_, t + 1);
+            return true;
+        }
+
+        // Producer only: pushes the first elements of [first, first + count) that fit, returns how
+        // many. If a copy throws, the elements before it are still pushed.
+        template <typename InputIt>
+        size_type push_n(InputIt first, size_type count)
+        {
+            const size_type t = tail_;
+            size_type room = capacity_ - (t - cached_head_);
+            if (room < count)
+            {
+                cached_head_ = atomic_load(&head_);
+                room = capacity_ - (t - cached_head_);
+            }
+            if (count > room)
+                count = room;
+            size_type done = 0;
+            try
+            {
+                for (; done < count; ++done, ++first)
+                    alloc_.construct(&slots_[(t + done) & mask_], *first);
+            }
+            catch (...)
+            {
+                atomic_store(&tail_, t + done);
+                throw;
+            }
+            atomic_store(&tail_, t + done);
+            return done;
+        }
+
+        // Consumer only; false when empty
+        bool try_pop(value_type &out)
+        {
+            const size_type h = head_;
+            if (h == cached_tail_)
+            {
+                cached_tail_ = atomic_load(&tail_);
+                if (h == cached_tail_)
+                    return false;
+            }
+            value_type &slot = slots_[h & mask_];
+            out = slot;
+            alloc_.destroy(&slot);
+            atomic_store(&head_, h + 1);
+            return true;
+        }
+
+        // Consumer only: pops up to count elements into out, returns how many. If a copy throws,
+        // the element being copied stays at the front.
+        template <typename OutputIt>
+        size_type pop_n(OutputIt out, size_type count)
+        {
+            const size_type h = head_;
+            size_type available = cached_tail_ - h;
+            if (available < count)
+            {
+                cached_tail_ = atomic_load(&tail_);
+                available = cached_tail_ - h;
+            }
+            if (count > available)
+                count = available;
+            size_type done = 0;
+            try
+            {
+                for (; done < count; ++done)
+                {
+                    value_type &slot = slots_[(h + done) & mask_];
+                    *out = slot;
+                    ++out;
+                    alloc_.destroy(&slot);
+                }
+            }
+            catch (...)
+            {
+                atomic_store(&head_, h + done);
+                throw;
+            }
+            atomic_store(&head_, h + done);
+            return done;
+        }
+
+        // Snapshots: the other side may change them right after
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        size_type size() const
+        {
+            return atomic_load(&tail_) - atomic_load(&head_);
+        }
+
+        size_type capacity() const
+        {
+            return capacity_;
+        }
+
+    private:
+        spsc_queue(const spsc_queue &);
+        spsc_queue &operator=(const spsc_queue &);
+
+        // Throws std::length_error when no power of two of size_type holds capacity
+        static size_type round_up(size_type capacity)
+        {
+            if (capacity > static_cast<size_type>(-1) / 2 + 1)
+                throw std::length_error("ft::spsc_queue capacity too large");
+            size_type rounded = 2;
+            while (rounded < capacity)
+                rounded <<= 1;
+            return rounded;
+        }
+
+    private:
+        // Producer line
+        size_type tail_;
+        size_type cached_head_;
+        char producer_pad_[FT_CACHE_LINE_SIZE - 2 * sizeof(size_type)];
+        // Consumer line
+        size_type head_;
+        size_type cached_tail_;
+        char consumer_pad_[FT_CACHE_LINE_SIZE - 2 * sizeof(size_type)];
+        // Read-only after construction
+        allocator_type alloc_;
+        const size_type capacity_;
+        const size_type mask_;
+        T *slots_;
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
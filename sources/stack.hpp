@@ -13,6 +13,8 @@
 #ifndef STACK_HPP
 # define STACK_HPP
 
+# include "allocator_traits.hpp"
+# include "polymorphic_allocator.hpp"
 # include "vector.hpp"
 
 namespace ft
@@ -41,6 +43,28 @@ namespace ft
 		{
 		}
 
+		// Allocator-extended constructors: the container's memory comes from alloc
+		template <typename Alloc>
+		explicit stack(const Alloc &alloc,
+					   typename enable_if<uses_allocator<container_type, Alloc>::value>::type * = NULL)
+			: c(alloc)
+		{
+		}
+
+		template <typename Alloc>
+		stack(const container_type &ctnr, const Alloc &alloc,
+			  typename enable_if<uses_allocator<container_type, Alloc>::value>::type * = NULL)
+			: c(ctnr, alloc)
+		{
+		}
+
+		template <typename Alloc>
+		stack(const stack &rhs, const Alloc &alloc,
+			  typename enable_if<uses_allocator<container_type, Alloc>::value>::type * = NULL)
+			: c(rhs.c, alloc)
+		{
+		}
+
 		stack &operator=(const stack &rhs)
 		{
 			if (this != &rhs)
@@ -84,6 +108,11 @@ namespace ft
 			c.pop_back();
 		}
 
+		void swap(stack &other)
+		{
+			c.swap(other.c);
+		}
+
         /**
          * @brief Friend Function
          * Friend Function a friend function can be given a special grant to access private and protected members. A friend function can be: 
@@ -142,6 +171,22 @@ namespace ft
 	{
 		return !(lhs < rhs);
 	}
+
+	template <typename T1, typename C1>
+	inline void swap(stack<T1, C1> &lhs, stack<T1, C1> &rhs)
+	{
+		lhs.swap(rhs);
+	}
+
+	namespace pmr
+	{
+		// ft::stack allocating from a memory_resource
+		template <typename T>
+		struct stack
+		{
+			typedef ft::stack<T, typename vector<T>::type> type;
+		};
+	} // namespace pmr
 } // end of namesapce
 
 #endif
\ No newline at end of file
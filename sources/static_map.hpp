@@ -0,0 +1,386 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   static_map.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:31:12 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 15:31:12 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STATIC_MAP_HPP
+# define STATIC_MAP_HPP
+
+# include <functional>
+# include <iterator>
+# include <memory>
+# include <stdexcept>
+
+# include "map.hpp"
+# include "tree_algorithm.hpp"
+# include "vector.hpp"
+
+/**
+ * @brief Immutable sorted map for build-once, read-many data. Keys are stored in Eytzinger order
+ * (the implicit binary tree of heap sort: children of k are 2k and 2k + 1) in one array, values
+ * in a second array with the same layout, so a search only walks over keys.
+ *
+ * The search loop has no data-dependent branch: each step is k = 2k + (key[k] < x). Because the
+ * 2^i descendants of a node are contiguous, the cache line holding the node four levels further
+ * down is prefetched while the current level is compared.
+ *
+ * Built from any range sorted by key without duplicates, for example an ft::map or a sorted
+ * ft::vector of pairs.
+ *
+ * @link https://arxiv.org/abs/1509.05053 @endlink
+ * @link https://algorithmica.org/en/eytzinger @endlink
+ */
+
+namespace ft
+{
+    // 1 + index of the lowest set bit of k, 0 when k is 0 (ffs), a loop for compilers without the builtin
+    inline std::size_t static_map_ffs(std::size_t k)
+    {
+#if defined(__GNUC__)
+        return static_cast<std::size_t>(__builtin_ffsl(static_cast<long>(k)));
+#else
+        if (k == 0)
+            return 0;
+        std::size_t n = 1;
+        for (; (k & 1) == 0; k >>= 1)
+            ++n;
+        return n;
+#endif
+    }
+
+    // What a static_map iterator points to: the key and the value are not stored together
+    template <typename Key, typename T>
+    struct static_map_reference
+    {
+        const Key &first;
+        const T &second;
+
+        static_map_reference(const Key &k, const T &v) : first(k), second(v)
+        {
+        }
+
+        const static_map_reference *operator->() const
+        {
+            return this;
+        }
+    };
+
+    template <typename Key, typename T, typename Compare = std::less<Key>,
+              typename Allocator = std::allocator<pair<const Key, T> > >
+    class static_map
+    {
+    public:
+        typedef Key                                      key_type;
+        typedef T                                        mapped_type;
+        typedef pair<const key_type, mapped_type>        value_type;
+        typedef Compare                                  key_compare;
+        typedef Allocator                                allocator_type;
+        typedef typename allocator_type::size_type       size_type;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef static_map_reference<key_type, mapped_type> reference;
+
+    private:
+        typedef vector<key_type, typename allocator_type::template rebind<key_type>::other> key_vector;
+        typedef vector<mapped_type, typename allocator_type::template rebind<mapped_type>::other> value_vector;
+
+    public:
+        // Bidirectional, walks the implicit tree in order; index 0 is end()
+        class const_iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef typename static_map::value_type value_type;
+            typedef static_map_reference<key_type, mapped_type> reference;
+            typedef reference pointer;
+            typedef typename static_map::difference_type difference_type;
+
+        public:
+            const_iterator() : owner_(NULL), k_(0)
+            {
+            }
+
+            const_iterator(const static_map *owner, size_type k) : owner_(owner), k_(k)
+            {
+            }
+
+        public:
+            reference operator*() const
+            {
+                return reference(owner_->keys_[k_], owner_->values_[k_]);
+            }
+
+            pointer operator->() const
+            {
+                return operator*();
+            }
+
+            const_iterator &operator++()
+            {
+                const size_type n = owner_->size();
+                if (2 * k_ + 1 <= n)
+                {
+                    k_ = 2 * k_ + 1;
+                    while (2 * k_ <= n)
+                        k_ = 2 * k_;
+                }
+                else
+                    k_ >>= static_map_ffs(~k_);
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                const_iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            const_iterator &operator--()
+            {
+                const size_type n = owner_->size();
+                if (k_ == 0)
+                    k_ = rightmost(1, n);
+                else if (2 * k_ <= n)
+                    k_ = rightmost(2 * k_, n);
+                else
+                    k_ >>= static_map_ffs(k_);
+                return *this;
+            }
+
+            const_iterator operator--(int)
+            {
+                const_iterator tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            bool operator==(const const_iterator &other) const
+            {
+                return k_ == other.k_;
+            }
+
+            bool operator!=(const const_iterator &other) const
+            {
+                return k_ != other.k_;
+            }
+
+        private:
+            static size_type rightmost(size_type k, size_type n)
+            {
+                while (2 * k + 1 <= n)
+                    k = 2 * k + 1;
+                return k;
+            }
+
+        private:
+            const static_map *owner_;
+            size_type k_;
+        };
+
+        typedef const_iterator iterator;
+        typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+        typedef const_reverse_iterator reverse_iterator;
+
+        friend class const_iterator;
+
+    public:
+        static_map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+            : comp_(comp), keys_(alloc), values_(alloc), size_(0)
+        {
+        }
+
+        // [first, last) must be sorted by key and without duplicates
+        template <typename InputIt>
+        static_map(InputIt first, InputIt last, const key_compare &comp = key_compare(),
+                   const allocator_type &alloc = allocator_type())
+            : comp_(comp), keys_(alloc), values_(alloc), size_(0)
+        {
+            build(first, last);
+        }
+
+        template <typename MapAllocator, typename Balance>
+        explicit static_map(const map<key_type, mapped_type, key_compare, MapAllocator, Balance> &m)
+            : comp_(m.key_comp()), keys_(), values_(), size_(0)
+        {
+            build(m.begin(), m.end());
+        }
+
+    public:
+        const_iterator begin() const
+        {
+            size_type k = size_ == 0 ? 0 : 1;
+            while (k != 0 && 2 * k <= size_)
+                k = 2 * k;
+            return const_iterator(this, k);
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(this, 0);
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        size_type size() const
+        {
+            return size_;
+        }
+
+        key_compare key_comp() const
+        {
+            return comp_;
+        }
+
+        const mapped_type &at(const key_type &key) const
+        {
+            size_type k = find_index(key);
+            if (k == 0)
+                throw std::out_of_range("Key not found");
+            return values_[k];
+        }
+
+        const_iterator find(const key_type &key) const
+        {
+            return const_iterator(this, find_index(key));
+        }
+
+        size_type count(const key_type &key) const
+        {
+            return find_index(key) == 0 ? 0 : 1;
+        }
+
+        bool contains(const key_type &key) const
+        {
+            return find_index(key) != 0;
+        }
+
+        // First element not less than key
+        const_iterator lower_bound(const key_type &key) const
+        {
+            return const_iterator(this, lower_index(key));
+        }
+
+        // First element greater than key
+        const_iterator upper_bound(const key_type &key) const
+        {
+            return const_iterator(this, upper_index(key));
+        }
+
+        pair<const_iterator, const_iterator> equal_range(const key_type &key) const
+        {
+            const_iterator it = find(key);
+            if (it == end())
+                return ft::make_pair(it, it);
+            const_iterator next = it;
+            return ft::make_pair(it, ++next);
+        }
+
+    private:
+        // Keys per cache line, the distance in levels between a node and the line prefetched for it
+        static size_type prefetch_stride()
+        {
+            return sizeof(key_type) >= 64 ? 1 : 64 / sizeof(key_type);
+        }
+
+        void prefetch(size_type k) const
+        {
+            size_type ahead = k * prefetch_stride();
+            if (ahead <= size_)
+                tree_prefetch(&keys_[ahead]);
+        }
+
+        // Both searches end below a leaf; dropping the trailing right turns plus one more level
+        // gives the node where the path last went left, or 0 when it never did
+        size_type lower_index(const key_type &key) const
+        {
+            size_type k = 1;
+            while (k <= size_)
+            {
+                prefetch(k);
+                k = 2 * k + static_cast<size_type>(comp_(keys_[k], key));
+            }
+            return k >> static_map_ffs(~k);
+        }
+
+        size_type upper_index(const key_type &key) const
+        {
+            size_type k = 1;
+            while (k <= size_)
+            {
+                prefetch(k);
+                k = 2 * k + static_cast<size_type>(!comp_(key, keys_[k]));
+            }
+            return k >> static_map_ffs(~k);
+        }
+
+        size_type find_index(const key_type &key) const
+        {
+            size_type k = lower_index(key);
+            if (k != 0 && comp_(key, keys_[k]))
+                return 0;
+            return k;
+        }
+
+        template <typename InputIt>
+        void build(InputIt first, InputIt last)
+        {
+            key_vector sorted_keys(keys_.get_allocator());
+            value_vector sorted_values(values_.get_allocator());
+            for (; first != last; ++first)
+            {
+                sorted_keys.push_back(first->first);
+                sorted_values.push_back(first->second);
+            }
+            size_ = sorted_keys.size();
+            if (size_ == 0)
+                return;
+
+            // Slot 0 is never read, it only keeps the arrays 1-based
+            keys_.assign(size_ + 1, sorted_keys[0]);
+            values_.assign(size_ + 1, sorted_values[0]);
+            fill(sorted_keys, sorted_values, 0, 1);
+        }
+
+        // In-order walk of the implicit tree, taking the sorted elements one by one
+        size_type fill(const key_vector &sorted_keys, const value_vector &sorted_values,
+                       size_type i, size_type k)
+        {
+            if (k <= size_)
+            {
+                i = fill(sorted_keys, sorted_values, i, 2 * k);
+                keys_[k] = sorted_keys[i];
+                values_[k] = sorted_values[i];
+                i = fill(sorted_keys, sorted_values, i + 1, 2 * k + 1);
+            }
+            return i;
+        }
+
+    private:
+        key_compare comp_;
+        key_vector keys_;
+        value_vector values_;
+        size_type size_;
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,486 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   static_vector.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:41:05 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 10:41:05 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STATIC_VECTOR_HPP
+# define STATIC_VECTOR_HPP
+
+# include <algorithm>
+# include <cstddef>
+# include <new>
+# include <stdexcept>
+
+# include "type_trait.hpp"
+# include "iterator.hpp"
+# include "random_access_iterator.hpp"
+# include "stack.hpp"
+# include "utility.hpp"
+
+/**
+ * @brief Vector with room for N elements inside the object itself: no allocator, no heap, and the
+ * elements sit next to the size, so a small bounded stack of them stays in a cache line or two.
+ * Elements are constructed in place on push and destroyed on pop; the unused part of the storage
+ * is raw memory.
+ *
+ * What happens when an operation would need more than N elements is the Overflow policy:
+ *  - checked_overflow (default) throws std::length_error before anything is changed. Only
+ *    assign from a single-pass input range cannot measure it first: that one throws once the
+ *    range outgrows N, holding the first N elements read.
+ *  - unchecked_overflow checks nothing, for hot paths whose bound is already proven; exceeding
+ *    N is then undefined behaviour, like indexing past the end.
+ *
+ * ft::static_stack<T, N>::type is the matching ft::stack.
+ *
+ * @link https://www.boost.org/doc/libs/release/doc/html/container/non_standard_containers.html#container.non_standard_containers.static_vector @endlink
+ * @link https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2023/p0843r8.html @endlink
+ */
+
+namespace ft
+{
+    struct checked_overflow
+    {
+        static void check(std::size_t required, std::size_t capacity)
+        {
+            if (required > capacity)
+                throw std::length_error("ft::static_vector capacity exceeded");
+        }
+    };
+
+    struct unchecked_overflow
+    {
+        static void check(std::size_t, std::size_t)
+        {
+        }
+    };
+
+    template <typename T, std::size_t N, typename Overflow = checked_overflow>
+    class static_vector
+    {
+    public:
+        typedef T                                               value_type;
+        typedef Overflow                                        overflow_policy;
+        typedef std::size_t                                     size_type;
+        typedef std::ptrdiff_t                                  difference_type;
+        typedef value_type&                                     reference;
+        typedef const value_type&                               const_reference;
+        typedef value_type*                                     pointer;
+        typedef const value_type*                               const_pointer;
+        typedef random_access_iterator<pointer, static_vector>        iterator;
+        typedef random_access_iterator<const_pointer, static_vector>  const_iterator;
+        typedef ft::reverse_iterator<iterator>                  reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+
+    public:
+        static_vector() : size_(0)
+        {
+        }
+
+        explicit static_vector(size_type count, const value_type &value = value_type())
+            : size_(0)
+        {
+            Overflow::check(count, N);
+            guarded_fill(count, value);
+        }
+
+        template <typename InputIt>
+        static_vector(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+            : size_(0)
+        {
+            try
+            {
+                for (; first != last; ++first)
+                    push_back(*first);
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        static_vector(const static_vector &other)
+            : size_(0)
+        {
+            try
+            {
+                for (; size_ < other.size_; ++size_)
+                    new (data() + size_) value_type(other[size_]);
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        ~static_vector()
+        {
+            clear();
+        }
+
+        static_vector &operator=(const static_vector &other)
+        {
+            if (this != &other)
+                assign(other.begin(), other.end());
+            return *this;
+        }
+
+        void assign(size_type count, const value_type &value)
+        {
+            Overflow::check(count, N);
+            clear();
+            guarded_fill(count, value);
+        }
+
+        template <typename InputIt>
+        void assign(InputIt first, typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+        {
+            typedef typename iterator_traits<InputIt>::iterator_category category;
+            range_assign(first, last, category());
+        }
+
+    // Element access
+    public:
+        reference at(size_type pos)
+        {
+            check_range(pos);
+            return data()[pos];
+        }
+
+        const_reference at(size_type pos) const
+        {
+            check_range(pos);
+            return data()[pos];
+        }
+
+        reference operator[](size_type pos)
+        {
+            return data()[pos];
+        }
+
+        const_reference operator[](size_type pos) const
+        {
+            return data()[pos];
+        }
+
+        reference front()
+        {
+            return data()[0];
+        }
+
+        const_reference front() const
+        {
+            return data()[0];
+        }
+
+        reference back()
+        {
+            return data()[size_ - 1];
+        }
+
+        const_reference back() const
+        {
+            return data()[size_ - 1];
+        }
+
+        pointer data()
+        {
+            return reinterpret_cast<pointer>(storage_);
+        }
+
+        const_pointer data() const
+        {
+            return reinterpret_cast<const_pointer>(storage_);
+        }
+
+    // Iterators
+    public:
+        iterator begin()
+        {
+            return iterator(data());
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(data());
+        }
+
+        iterator end()
+        {
+            return iterator(data() + size_);
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(data() + size_);
+        }
+
+        reverse_iterator rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+    // Capacity
+    public:
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        bool full() const
+        {
+            return size_ == N;
+        }
+
+        size_type size() const
+        {
+            return size_;
+        }
+
+        size_type max_size() const
+        {
+            return N;
+        }
+
+        size_type capacity() const
+        {
+            return N;
+        }
+
+    // Modifiers
+    public:
+        void clear()
+        {
+            destroy_from(0);
+        }
+
+        void push_back(const value_type &value)
+        {
+            Overflow::check(size_ + 1, N);
+            new (data() + size_) value_type(value);
+            ++size_;
+        }
+
+        // push_back that reports a full vector instead of applying the policy
+        bool try_push_back(const value_type &value)
+        {
+            if (size_ == N)
+                return false;
+            new (data() + size_) value_type(value);
+            ++size_;
+            return true;
+        }
+
+        void pop_back()
+        {
+            --size_;
+            data()[size_].~value_type();
+        }
+
+        // New elements are constructed at the end, then rotated into place
+        iterator insert(iterator pos, const value_type &value)
+        {
+            const size_type index = pos - begin();
+            push_back(value);
+            std::rotate(data() + index, data() + size_ - 1, data() + size_);
+            return begin() + index;
+        }
+
+        void insert(iterator pos, size_type count, const value_type &value)
+        {
+            Overflow::check(size_ + count, N);
+            const size_type index = pos - begin();
+            const size_type old_size = size_;
+            try
+            {
+                for (; count > 0; --count)
+                    push_back(value);
+            }
+            catch (...)
+            {
+                destroy_from(old_size);
+                throw;
+            }
+            std::rotate(data() + index, data() + old_size, data() + size_);
+        }
+
+        template <typename InputIt>
+        void insert(iterator pos, InputIt first,
+                    typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+        {
+            const size_type index = pos - begin();
+            const size_type old_size = size_;
+            try
+            {
+                for (; first != last; ++first)
+                    push_back(*first);
+            }
+            catch (...)
+            {
+                destroy_from(old_size);
+                throw;
+            }
+            std::rotate(data() + index, data() + old_size, data() + size_);
+        }
+
+        iterator erase(iterator pos)
+        {
+            return erase(pos, pos + 1);
+        }
+
+        iterator erase(iterator first, iterator last)
+        {
+            const size_type index = first - begin();
+            std::copy(last.base(), data() + size_, first.base());
+            destroy_from(size_ - size_type(last - first));
+            return begin() + index;
+        }
+
+        void resize(size_type count, value_type value = value_type())
+        {
+            Overflow::check(count, N);
+            if (count < size_)
+                destroy_from(count);
+            else
+                guarded_fill(count - size_, value);
+        }
+
+        void swap(static_vector &other)
+        {
+            static_vector &shorter = size_ < other.size_ ? *this : other;
+            static_vector &longer = size_ < other.size_ ? other : *this;
+            const size_type common = shorter.size_;
+            std::swap_ranges(shorter.data(), shorter.data() + common, longer.data());
+            for (size_type i = common; i < longer.size_; ++i)
+                shorter.push_back(longer[i]);
+            longer.destroy_from(common);
+        }
+
+    private:
+        void check_range(size_type pos) const
+        {
+            if (pos >= size_)
+                throw std::out_of_range("Index is out of static_vector range");
+        }
+
+        template <typename InputIt>
+        void range_assign(InputIt first, InputIt last, std::input_iterator_tag)
+        {
+            clear();
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        template <typename ForwardIt>
+        void range_assign(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+        {
+            Overflow::check(static_cast<size_type>(std::distance(first, last)), N);
+            clear();
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        // Appends count copies; on a throw the ones already appended are kept
+        void guarded_fill(size_type count, const value_type &value)
+        {
+            const size_type old_size = size_;
+            try
+            {
+                for (; count > 0; --count)
+                    push_back(value);
+            }
+            catch (...)
+            {
+                destroy_from(old_size);
+                throw;
+            }
+        }
+
+        // Destroys the elements from index `first` on
+        void destroy_from(size_type first)
+        {
+            if (!is_trivially_destructible<value_type>::value)
+                for (size_type i = first; i < size_; ++i)
+                    data()[i].~value_type();
+            size_ = first;
+        }
+
+    private:
+        size_type size_;
+        char storage_[sizeof(T) * (N == 0 ? 1 : N)] __attribute__((aligned(__alignof__(T))));
+    };
+
+    template <typename T, std::size_t N, typename Overflow>
+    inline bool operator==(const static_vector<T, N, Overflow> &lhs, const static_vector<T, N, Overflow> &rhs)
+    {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename T, std::size_t N, typename Overflow>
+    inline bool operator!=(const static_vector<T, N, Overflow> &lhs, const static_vector<T, N, Overflow> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename T, std::size_t N, typename Overflow>
+    inline bool operator<(const static_vector<T, N, Overflow> &lhs, const static_vector<T, N, Overflow> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, std::size_t N, typename Overflow>
+    inline bool operator<=(const static_vector<T, N, Overflow> &lhs, const static_vector<T, N, Overflow> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename T, std::size_t N, typename Overflow>
+    inline bool operator>(const static_vector<T, N, Overflow> &lhs, const static_vector<T, N, Overflow> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename T, std::size_t N, typename Overflow>
+    inline bool operator>=(const static_vector<T, N, Overflow> &lhs, const static_vector<T, N, Overflow> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename T, std::size_t N, typename Overflow>
+    inline void swap(static_vector<T, N, Overflow> &lhs, static_vector<T, N, Overflow> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    // ft::stack on inline storage, for traversals and parsers with a known depth bound
+    template <typename T, std::size_t N, typename Overflow = checked_overflow>
+    struct static_stack
+    {
+        typedef ft::stack<T, static_vector<T, N, Overflow> > type;
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,304 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_cache_allocator.hpp                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:22:05 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 13:22:05 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef THREAD_CACHE_ALLOCATOR_HPP
+# define THREAD_CACHE_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <limits>
+# include <new>
+# include <pthread.h>
+
+# include "mutex.hpp"
+# include "type_trait.hpp"
+
+/**
+ * @brief Allocator for node churn in multi-threaded programs: requests up to 256 bytes are served
+ * from per-thread free lists, one per 16-byte size class, without any lock. A thread's list is
+ * refilled from, and overflows back to, a central pool in batches of 32 blocks, so the central
+ * lock is taken once per batch instead of once per node.
+ *
+ * Blocks are interchangeable between threads: a block freed by another thread than the one that
+ * allocated it joins the freeing thread's list, and reaches the central pool when that list
+ * overflows or the thread exits. Memory is never returned to the system; the pool keeps the peak
+ * of what all threads held at once, like tcmalloc's central free lists.
+ *
+ * Larger requests (vector storage) go to ::operator new. The allocator is stateless: all instances
+ * compare equal and containers may exchange memory freely.
+ *
+ * @link https://google.github.io/tcmalloc/design.html @endlink
+ * @link https://gcc.gnu.org/onlinedocs/gcc/Thread-Local.html @endlink
+ */
+
+namespace ft
+{
+    class thread_cache
+    {
+    public:
+        static const std::size_t granularity = 16;
+        static const std::size_t max_size = 256;
+        static const std::size_t classes = max_size / granularity;
+        static const std::size_t batch = 32;
+        static const std::size_t chunk_bytes = 64 * 1024;
+
+        // Size class of a request of at most max_size bytes
+        static std::size_t size_class(std::size_t bytes)
+        {
+            return bytes == 0 ? 0 : (bytes - 1) / granularity;
+        }
+
+        static void *allocate(std::size_t size_class)
+        {
+            bin &b = bins()[size_class];
+            if (b.head == NULL)
+                refill(b, size_class);
+            free_block *block = b.head;
+            b.head = block->next;
+            --b.count;
+            return block;
+        }
+
+        static void deallocate(void *ptr, std::size_t size_class)
+        {
+            bin &b = bins()[size_class];
+            free_block *block = static_cast<free_block *>(ptr);
+            block->next = b.head;
+            b.head = block;
+            if (++b.count >= 2 * batch)
+                release(b, size_class, batch);
+        }
+
+    private:
+        // A batch is a list of blocks; its first block links the next batch of the central pool
+        struct free_block
+        {
+            free_block *next;
+            free_block *next_batch;
+        };
+
+        // Per-thread list; a POD because __thread objects cannot have constructors
+        struct bin
+        {
+            free_block *head;
+            std::size_t count;
+        };
+
+        // A thread's lists, and whether the exit hook is armed for them
+        struct thread_bins
+        {
+            bin cache[classes];
+            bool registered;
+        };
+
+        struct central_list
+        {
+            mutex lock;
+            free_block *batches;
+        };
+
+        // Process lifetime: never destroyed, so threads exiting after main can still flush
+        struct central
+        {
+            central_list lists[classes];
+            pthread_key_t exit_key;
+
+            central()
+            {
+                for (std::size_t i = 0; i < classes; ++i)
+                    lists[i].batches = NULL;
+                pthread_key_create(&exit_key, &thread_exit);
+            }
+        };
+
+        static central &pool()
+        {
+            static central *instance = new central();
+            return *instance;
+        }
+
+        static bin *bins()
+        {
+            static __thread thread_bins local;
+            if (!local.registered)
+            {
+                local.registered = true;
+                pthread_setspecific(pool().exit_key, &local);
+            }
+            return local.cache;
+        }
+
+        static void refill(bin &b, std::size_t size_class)
+        {
+            central_list &list = pool().lists[size_class];
+            free_block *taken;
+            {
+                lock_guard<mutex> guard(list.lock);
+                if (list.batches == NULL)
+                    carve(list, (size_class + 1) * granularity);
+                taken = list.batches;
+                list.batches = taken->next_batch;
+            }
+            std::size_t count = 0;
+            free_block *last = taken;
+            for (;; last = last->next)
+            {
+                ++count;
+                if (last->next == NULL)
+                    break;
+            }
+            last->next = b.head;
+            b.head = taken;
+            b.count += count;
+        }
+
+        // Hands the first count blocks of the list (all of them if fewer) to the central pool
+        static void release(bin &b, std::size_t size_class, std::size_t count)
+        {
+            free_block *first = b.head;
+            free_block *last = first;
+            std::size_t taken = 1;
+            for (; taken < count && last->next != NULL; ++taken)
+                last = last->next;
+            b.head = last->next;
+            b.count -= taken;
+            last->next = NULL;
+
+            central_list &list = pool().lists[size_class];
+            lock_guard<mutex> guard(list.lock);
+            first->next_batch = list.batches;
+            list.batches = first;
+        }
+
+        // Cuts a new chunk into batches, with the central lock held
+        static void carve(central_list &list, std::size_t block_size)
+        {
+            const std::size_t blocks = chunk_bytes / block_size / batch * batch;
+            char *raw = static_cast<char *>(::operator new(blocks * block_size));
+            for (std::size_t i = 0; i < blocks; i += batch)
+            {
+                free_block *head = reinterpret_cast<free_block *>(raw + i * block_size);
+                for (std::size_t j = 0; j < batch; ++j)
+                {
+                    free_block *block = reinterpret_cast<free_block *>(raw + (i + j) * block_size);
+                    block->next = j + 1 < batch
+                        ? reinterpret_cast<free_block *>(raw + (i + j + 1) * block_size)
+                        : NULL;
+                }
+                head->next_batch = list.batches;
+                list.batches = head;
+            }
+        }
+
+        // pthread key destructor: the exiting thread's blocks go back to the central pool. Other
+        // key destructors may still free blocks after this one ran: disarming lets bins() set the
+        // key again, and pthreads then calls this once more for them.
+        static void thread_exit(void *local)
+        {
+            thread_bins *exiting = static_cast<thread_bins *>(local);
+            exiting->registered = false;
+            for (std::size_t i = 0; i < classes; ++i)
+            {
+                while (exiting->cache[i].head != NULL)
+                    release(exiting->cache[i], i, batch);
+            }
+        }
+    };
+
+    template <typename T>
+    class thread_cache_allocator
+    {
+    public:
+        typedef T value_type;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef true_type is_always_equal;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef thread_cache_allocator<U> other;
+        };
+
+    public:
+        thread_cache_allocator()
+        {
+        }
+
+        template <typename U>
+        thread_cache_allocator(const thread_cache_allocator<U> &)
+        {
+        }
+
+    public:
+        pointer allocate(size_type n, const void * = NULL)
+        {
+            if (n > max_size())
+                throw std::bad_alloc();
+            const std::size_t bytes = n * sizeof(T);
+            if (bytes <= thread_cache::max_size)
+                return static_cast<pointer>(thread_cache::allocate(thread_cache::size_class(bytes)));
+            return static_cast<pointer>(::operator new(bytes));
+        }
+
+        void deallocate(pointer ptr, size_type n)
+        {
+            const std::size_t bytes = n * sizeof(T);
+            if (bytes <= thread_cache::max_size)
+                thread_cache::deallocate(ptr, thread_cache::size_class(bytes));
+            else
+                ::operator delete(ptr);
+        }
+
+        void construct(pointer ptr, const T &value)
+        {
+            new (static_cast<void *>(ptr)) T(value);
+        }
+
+        void destroy(pointer ptr)
+        {
+            ptr->~T();
+        }
+
+        pointer address(reference x) const
+        {
+            return &x;
+        }
+
+        const_pointer address(const_reference x) const
+        {
+            return &x;
+        }
+
+        size_type max_size() const
+        {
+            return std::numeric_limits<size_type>::max() / sizeof(T);
+        }
+    };
+
+    template <typename T, typename U>
+    inline bool operator==(const thread_cache_allocator<T> &, const thread_cache_allocator<U> &)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    inline bool operator!=(const thread_cache_allocator<T> &, const thread_cache_allocator<U> &)
+    {
+        return false;
+    }
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,466 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_pool.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:58:36 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 11:58:36 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef THREAD_POOL_HPP
+# define THREAD_POOL_HPP
+
+# include <cstddef>
+# include <new>
+# include <pthread.h>
+# include <sched.h>
+# include <stdexcept>
+# include <unistd.h>
+
+# include "atomic.hpp"
+# include "deque.hpp"
+# include "mutex.hpp"
+# include "thread_cache_allocator.hpp"
+# include "vector.hpp"
+# include "work_stealing_deque.hpp"
+
+/**
+ * @brief Work-stealing thread pool. Every worker owns an ft::work_stealing_deque: tasks spawned
+ * by a worker go to the bottom of its own deque and it runs them newest first, idle workers steal
+ * the oldest task of a random victim. Tasks submitted from outside the pool go through one shared
+ * queue. Workers with nothing to do spin briefly, then sleep until a task is queued.
+ *
+ *  - submit(fn) runs fn() once, some time before the pool is destroyed.
+ *  - task_group is fork-join: spawn(fn) queues fn(), wait() returns once every spawned task
+ *    finished, running queued tasks meanwhile instead of blocking, so a task can spawn and wait
+ *    on subtasks without tying up its thread.
+ *  - parallel_for(first, last, fn) calls fn(i) for every i in [first, last), splitting the range
+ *    in halves down to `grain` indices so thieves always take the biggest remaining piece.
+ *  - default_thread_pool() is a process-wide pool with one thread per core, started on first use;
+ *    the parallel algorithms of parallel.hpp run on it unless they are given a pool.
+ *
+ * Functions are copied into the task. They must not throw, and fn of parallel_for is shared by
+ * all threads. Tasks are allocated through ft::thread_cache_allocator, so spawning does not go
+ * through a global lock.
+ *
+ * @link https://en.wikipedia.org/wiki/Work_stealing @endlink
+ * @link http://supertech.csail.mit.edu/papers/steal.pdf @endlink
+ */
+
+namespace ft
+{
+    inline unsigned int parallel_default_threads()
+    {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        return n < 1 ? 1 : static_cast<unsigned int>(n);
+    }
+
+    // Type-erased queued function; execute() runs it and frees the task, discard() only frees it
+    class pool_task
+    {
+    public:
+        virtual void execute() = 0;
+        virtual void discard() = 0;
+
+    protected:
+        virtual ~pool_task()
+        {
+        }
+    };
+
+    template <typename Function>
+    class pool_function_task : public pool_task
+    {
+    private:
+        typedef thread_cache_allocator<pool_function_task> allocator_type;
+
+    public:
+        // pending, when not NULL, is decremented once the task has run and been freed
+        static pool_function_task *create(const Function &fn, std::size_t *pending)
+        {
+            allocator_type alloc;
+            pool_function_task *task = alloc.allocate(1);
+            try
+            {
+                new (static_cast<void *>(task)) pool_function_task(fn, pending);
+            }
+            catch (...)
+            {
+                alloc.deallocate(task, 1);
+                throw;
+            }
+            return task;
+        }
+
+        void execute()
+        {
+            fn_();
+            std::size_t *pending = pending_;
+            this->~pool_function_task();
+            allocator_type().deallocate(this, 1);
+            if (pending != NULL)
+                atomic_fetch_sub(pending, std::size_t(1));
+        }
+
+        void discard()
+        {
+            this->~pool_function_task();
+            allocator_type().deallocate(this, 1);
+        }
+
+    private:
+        pool_function_task(const Function &fn, std::size_t *pending)
+            : fn_(fn), pending_(pending)
+        {
+        }
+
+    private:
+        Function fn_;
+        std::size_t *pending_;
+    };
+
+    class task_group;
+
+    class thread_pool
+    {
+    private:
+        struct worker
+        {
+            thread_pool *pool;
+            work_stealing_deque<pool_task *> tasks;
+            pthread_t thread;
+            unsigned int seed; // Victim selection
+
+            worker(thread_pool *p, unsigned int s) : pool(p), tasks(), thread(), seed(s)
+            {
+            }
+        };
+
+        // Failed attempts to find a task before a worker goes to sleep
+        enum { spin_limit = 64 };
+
+        friend class task_group;
+
+    public:
+        // threads == 0 uses every core
+        explicit thread_pool(unsigned int threads = 0)
+            : queued_(0), injected_size_(0), sleepers_(0), stop_(false)
+        {
+            pthread_cond_init(&wake_, NULL);
+            if (threads == 0)
+                threads = parallel_default_threads();
+            try
+            {
+                for (unsigned int i = 0; i < threads; ++i)
+                {
+                    workers_.push_back(NULL);
+                    workers_.back() = new worker(this, 2 * i + 1);
+                }
+                for (unsigned int i = 0; i < threads; ++i)
+                {
+                    if (pthread_create(&workers_[i]->thread, NULL, &thread_pool::work, workers_[i]) != 0)
+                    {
+                        shutdown(i);
+                        throw std::runtime_error("ft::thread_pool cannot start its threads");
+                    }
+                }
+            }
+            catch (...)
+            {
+                for (std::size_t i = 0; i < workers_.size(); ++i)
+                    delete workers_[i];
+                pthread_cond_destroy(&wake_);
+                throw;
+            }
+        }
+
+        // Runs every task still queued, then joins the threads
+        ~thread_pool()
+        {
+            shutdown(workers_.size());
+            for (std::size_t i = 0; i < workers_.size(); ++i)
+                delete workers_[i];
+            pthread_cond_destroy(&wake_);
+        }
+
+    public:
+        template <typename Function>
+        void submit(Function fn)
+        {
+            schedule(pool_function_task<Function>::create(fn, NULL));
+        }
+
+        template <typename Function>
+        void parallel_for(std::size_t first, std::size_t last, Function fn, std::size_t grain = 0);
+
+        unsigned int size() const
+        {
+            return static_cast<unsigned int>(workers_.size());
+        }
+
+    private:
+        thread_pool(const thread_pool &);
+        thread_pool &operator=(const thread_pool &);
+
+        // The worker running on this thread, NULL outside of any pool
+        static worker *&current_worker()
+        {
+            static __thread worker *current = NULL;
+            return current;
+        }
+
+        worker *own_worker() const
+        {
+            worker *self = current_worker();
+            return self != NULL && self->pool == this ? self : NULL;
+        }
+
+        // On a throw the task is discarded
+        void schedule(pool_task *task)
+        {
+            // Counted before it is visible, so a sleeping worker never misses it
+            atomic_fetch_add(&queued_, std::size_t(1));
+            try
+            {
+                worker *self = own_worker();
+                if (self != NULL)
+                    self->tasks.push(task);
+                else
+                {
+                    lock_guard<mutex> lock(inject_mutex_);
+                    injected_.push_back(task);
+                    atomic_store(&injected_size_, injected_.size());
+                }
+            }
+            catch (...)
+            {
+                atomic_fetch_sub(&queued_, std::size_t(1));
+                task->discard();
+                throw;
+            }
+            atomic_thread_fence();
+            if (atomic_load(&sleepers_) != 0)
+            {
+                lock_guard<mutex> lock(sleep_mutex_);
+                pthread_cond_signal(&wake_);
+            }
+        }
+
+        // Own deque first, then the shared queue, then the other workers from a random one
+        pool_task *take(worker *self)
+        {
+            pool_task *task;
+            if (self != NULL && self->tasks.pop(task))
+                return task;
+            if (atomic_load(&injected_size_) != 0)
+            {
+                lock_guard<mutex> lock(inject_mutex_);
+                if (!injected_.empty())
+                {
+                    task = injected_.front();
+                    injected_.pop_front();
+                    atomic_store(&injected_size_, injected_.size());
+                    return task;
+                }
+            }
+            const std::size_t count = workers_.size();
+            std::size_t start = 0;
+            if (self != NULL)
+            {
+                self->seed ^= self->seed << 13;
+                self->seed ^= self->seed >> 17;
+                self->seed ^= self->seed << 5;
+                start = self->seed % count;
+            }
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                worker *victim = workers_[(start + i) % count];
+                if (victim != self && victim->tasks.steal(task))
+                    return task;
+            }
+            return NULL;
+        }
+
+        // Runs one queued task, if any; used by the workers and by waiting threads
+        bool run_one()
+        {
+            pool_task *task = take(own_worker());
+            if (task == NULL)
+                return false;
+            atomic_fetch_sub(&queued_, std::size_t(1));
+            task->execute();
+            return true;
+        }
+
+        // Sleeps until a task is queued; false when the pool stops and nothing is left
+        bool sleep()
+        {
+            lock_guard<mutex> lock(sleep_mutex_);
+            atomic_fetch_add(&sleepers_, 1U);
+            atomic_thread_fence();
+            while (atomic_load(&queued_) == 0 && !stop_)
+                pthread_cond_wait(&wake_, sleep_mutex_.native_handle());
+            atomic_fetch_sub(&sleepers_, 1U);
+            return atomic_load(&queued_) != 0;
+        }
+
+        static void *work(void *arg)
+        {
+            worker *self = static_cast<worker *>(arg);
+            current_worker() = self;
+            unsigned int idle = 0;
+            while (true)
+            {
+                if (self->pool->run_one())
+                    idle = 0;
+                else if (++idle < spin_limit)
+                    cpu_relax();
+                else if (self->pool->sleep())
+                    idle = 0;
+                else
+                    break;
+            }
+            current_worker() = NULL;
+            return NULL;
+        }
+
+        // Stops and joins the first `started` workers
+        void shutdown(std::size_t started)
+        {
+            {
+                lock_guard<mutex> lock(sleep_mutex_);
+                stop_ = true;
+                pthread_cond_broadcast(&wake_);
+            }
+            for (std::size_t i = 0; i < started; ++i)
+                pthread_join(workers_[i]->thread, NULL);
+        }
+
+    private:
+        vector<worker *> workers_;
+        std::size_t queued_;        // Tasks in any queue, not yet taken
+        mutex inject_mutex_;
+        deque<pool_task *> injected_;
+        std::size_t injected_size_;
+        mutex sleep_mutex_;
+        pthread_cond_t wake_;
+        unsigned int sleepers_;
+        bool stop_;                 // Guarded by sleep_mutex_
+    };
+
+    // Shared by everything that is not given its own pool, joined at exit
+    inline thread_pool &default_thread_pool()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Fork-join scope over a thread_pool. wait() (also called by the destructor) helps
+     * the pool run tasks until every task spawned through this group has finished.
+     */
+    class task_group
+    {
+    public:
+        explicit task_group(thread_pool &pool)
+            : pool_(pool), pending_(0)
+        {
+        }
+
+        ~task_group()
+        {
+            wait();
+        }
+
+    public:
+        template <typename Function>
+        void spawn(Function fn)
+        {
+            pool_task *task = pool_function_task<Function>::create(fn, &pending_);
+            atomic_fetch_add(&pending_, std::size_t(1));
+            try
+            {
+                pool_.schedule(task);
+            }
+            catch (...)
+            {
+                atomic_fetch_sub(&pending_, std::size_t(1));
+                throw;
+            }
+        }
+
+        void wait()
+        {
+            unsigned int idle = 0;
+            while (atomic_load(&pending_) != 0)
+            {
+                if (pool_.run_one())
+                    idle = 0;
+                else if (++idle < thread_pool::spin_limit)
+                    cpu_relax();
+                else
+                    sched_yield();
+            }
+        }
+
+    private:
+        task_group(const task_group &);
+        task_group &operator=(const task_group &);
+
+    private:
+        thread_pool &pool_;
+        std::size_t pending_;
+    };
+
+    // Calls (*fn)(i) over [first, last), handing the upper half of the range to the group while
+    // it is bigger than grain
+    template <typename Function>
+    class parallel_for_range
+    {
+    public:
+        parallel_for_range(task_group &group, std::size_t first, std::size_t last,
+                           std::size_t grain, Function *fn)
+            : group_(&group), first_(first), last_(last), grain_(grain), fn_(fn)
+        {
+        }
+
+        void operator()()
+        {
+            while (last_ - first_ > grain_)
+            {
+                const std::size_t middle = first_ + (last_ - first_) / 2;
+                group_->spawn(parallel_for_range(*group_, middle, last_, grain_, fn_));
+                last_ = middle;
+            }
+            for (std::size_t i = first_; i < last_; ++i)
+                (*fn_)(i);
+        }
+
+    private:
+        task_group *group_;
+        std::size_t first_;
+        std::size_t last_;
+        std::size_t grain_;
+        Function *fn_;
+    };
+
+    // grain == 0 picks about 8 pieces per thread
+    template <typename Function>
+    inline void thread_pool::parallel_for(std::size_t first, std::size_t last, Function fn, std::size_t grain)
+    {
+        if (first >= last)
+            return;
+        if (grain == 0)
+            grain = (last - first) / (std::size_t(size()) * 8);
+        if (grain == 0)
+            grain = 1;
+        task_group group(*this);
+        parallel_for_range<Function>(group, first, last, grain, &fn)();
+        group.wait();
+    }
+} // namespace ft
+
+#endif
\ No newline at end of file
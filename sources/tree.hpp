@@ -14,24 +14,161 @@
 # define TREE_HPP
 
 # include <algorithm>
+# include <functional>
 # include <iterator>
 # include <limits>
 
+# include "allocator_traits.hpp"
 # include "utility.hpp"
 # include "tree_algorithm.hpp"
+# include "tree_balance.hpp"
 # include "tree_iterator.hpp"
+# include "vector.hpp"
 
 namespace ft
 {
+	// Counters of the optional last-hit lookup cache
+	struct tree_cache_stats
+	{
+		std::size_t hits;
+		std::size_t misses;
+
+		tree_cache_stats() : hits(0), misses(0)
+		{
+		}
+
+		double hit_rate() const
+		{
+			std::size_t total = hits + misses;
+			return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+		}
+	};
+
+#ifdef FT_TREE_STATS
+	/**
+	 * @brief Instrumentation of an FT_TREE_STATS build: operation and comparator call counts,
+	 * rebalancing work and allocator traffic. Comparisons are attributed to the outermost public
+	 * operation that made them (erase(key) counts its lookup as erase work).
+	 */
+	struct tree_stats
+	{
+		std::size_t lookups;
+		std::size_t inserts;
+		std::size_t erases;
+		std::size_t comparisons;        // All comparator calls
+		std::size_t lookup_comparisons;
+		std::size_t insert_comparisons;
+		std::size_t erase_comparisons;
+		std::size_t rotations;
+		std::size_t recolorings;        // Nodes whose color changed during rebalancing
+		std::size_t allocations;        // Calls to the node allocator
+		std::size_t deallocations;
+		std::size_t bytes_in_use;       // Bytes currently held from the node allocator
+		std::size_t height;             // Current height, computed by tree::stats()
+		std::size_t max_height;         // Deepest node ever linked, or the largest height seen
+
+		tree_stats()
+			: lookups(0), inserts(0), erases(0), comparisons(0), lookup_comparisons(0),
+			  insert_comparisons(0), erase_comparisons(0), rotations(0), recolorings(0),
+			  allocations(0), deallocations(0), bytes_in_use(0), height(0), max_height(0)
+		{
+		}
+
+		double comparisons_per_lookup() const
+		{
+			return average(lookup_comparisons, lookups);
+		}
+
+		double comparisons_per_insert() const
+		{
+			return average(insert_comparisons, inserts);
+		}
+
+		double comparisons_per_erase() const
+		{
+			return average(erase_comparisons, erases);
+		}
+
+	private:
+		static double average(std::size_t total, std::size_t count)
+		{
+			return count == 0 ? 0.0 : static_cast<double>(total) / static_cast<double>(count);
+		}
+	};
+
+	// The Counter of the balancing policies in FT_TREE_STATS builds
+	struct tree_stats_counter
+	{
+		tree_stats &stats;
+
+		explicit tree_stats_counter(tree_stats &s) : stats(s)
+		{
+		}
+
+		void rotation()
+		{
+			++stats.rotations;
+		}
+
+		void recoloring(bool changed)
+		{
+			stats.recolorings += changed;
+		}
+	};
+
+	// Counts one operation and the comparisons made until it returns, unless one is already open
+	struct tree_stats_scope
+	{
+		tree_stats &stats;
+		bool &in_operation;
+		std::size_t *bucket;
+		std::size_t start;
+
+		tree_stats_scope(tree_stats &s, bool &active, std::size_t &operations, std::size_t &comparisons)
+			: stats(s), in_operation(active), bucket(NULL), start(s.comparisons)
+		{
+			if (!in_operation)
+			{
+				in_operation = true;
+				++operations;
+				bucket = &comparisons;
+			}
+		}
+
+		~tree_stats_scope()
+		{
+			if (bucket != NULL)
+			{
+				*bucket += stats.comparisons - start;
+				in_operation = false;
+			}
+		}
+	};
+
+# define FT_TREE_STATS_SCOPE(op) \
+	tree_stats_scope stats_scope(stats_, in_operation_, stats_.op##s, stats_.op##_comparisons)
+#else
+# define FT_TREE_STATS_SCOPE(op)
+#endif
+
+	// Node orders for tree::compact
+	enum tree_layout
+	{
+		tree_layout_bfs,     // Level by level: the top levels of every search share cache lines
+		tree_layout_in_order // Sorted: full scans read memory sequentially
+	};
+
 	// T -> pair<Key, value>
 	// Compare -> function to compare elements 
-	template <typename T, typename Compare, typename Allocator>
+	// Balance -> balancing policy (tree_balance.hpp)
+	template <typename T, typename Compare, typename Allocator, typename Balance = rb_balance>
 	class tree
 	{
 	public:
 		typedef T value_type;
 		typedef Compare value_compare;
 		typedef Allocator allocator_type;
+		typedef Balance balance_policy;
 		typedef typename allocator_type::size_type size_type;
 		typedef typename allocator_type::difference_type difference_type;
 		typedef value_type &reference;
@@ -47,6 +184,9 @@ namespace ft
 		typedef typename tree_node_types<value_type>::end_node_pointer end_node_pointer;
 		typedef typename tree_node_types<value_type>::node_pointer node_pointer;
 		typedef typename allocator_type::template rebind<node_type>::other node_allocator;
+		typedef allocator_traits<allocator_type> alloc_traits;
+
+		friend struct tree_access;
 
 	private:
 		node_allocator alloc_;
@@ -55,6 +195,16 @@ namespace ft
 		end_node_type end_node_;
 		end_node_pointer begin_iter_;
 		size_type size_;
+		bool cache_enabled_;
+		mutable end_node_pointer last_hit_;
+		mutable tree_cache_stats cache_stats_;
+		node_pointer block_;      // Contiguous nodes made by compact()
+		size_type block_size_;
+		node_pointer holes_;      // Erased nodes of block_, reused by construct_node (linked by right)
+#ifdef FT_TREE_STATS
+		mutable tree_stats stats_;
+		mutable bool in_operation_;
+#endif
 
 	public:
 		tree(const value_compare &comp)
@@ -62,32 +212,58 @@ namespace ft
 			  value_alloc_(allocator_type()),
 			  comp_(comp),
 			  end_node_(),
-			  size_(0)
+			  size_(0),
+			  cache_enabled_(false),
+			  last_hit_(NULL),
+			  block_(NULL),
+			  block_size_(0),
+			  holes_(NULL)
+#ifdef FT_TREE_STATS
+			  , in_operation_(false)
+#endif
 		{
 			begin_iter_ = end_node();
 		}
 
 		tree(const tree &other)
-			: alloc_(other.alloc_),
-			  value_alloc_(other.value_alloc_),
+			: alloc_(node_allocator(alloc_traits::select_on_container_copy_construction(other.value_alloc_))),
+			  value_alloc_(alloc_traits::select_on_container_copy_construction(other.value_alloc_)),
 			  comp_(other.comp_),
 			  end_node_(),
-			  size_(0)
+			  size_(0),
+			  cache_enabled_(other.cache_enabled_),
+			  last_hit_(NULL),
+			  block_(NULL),
+			  block_size_(0),
+			  holes_(NULL)
+#ifdef FT_TREE_STATS
+			  , in_operation_(false)
+#endif
 		{
 			begin_iter_ = end_node();
-			insert(other.begin(), other.end());
+			assign_sorted(other.begin(), other.end());
 		}
 
 		tree(const value_compare &comp, const allocator_type &alloc)
-			: alloc_(node_allocator()),
+			: alloc_(node_allocator(alloc)),
 			  value_alloc_(alloc),
 			  comp_(comp),
 			  end_node_(),
-			  size_(0)
+			  size_(0),
+			  cache_enabled_(false),
+			  last_hit_(NULL),
+			  block_(NULL),
+			  block_size_(0),
+			  holes_(NULL)
+#ifdef FT_TREE_STATS
+			  , in_operation_(false)
+#endif
 		{
 			begin_iter_ = end_node();
 		}
 
+		// The copy is built with the allocator this tree ends up with: other's when it propagates
+		// on copy assignment, its own otherwise
 		tree &operator=(const tree &other)
 		{
 			if (this == &other)
@@ -95,14 +271,20 @@ namespace ft
 				return *this;
 			}
 
-			tree tmp(other);
-			swap(tmp);
+			const bool propagate = alloc_traits::propagate_on_container_copy_assignment::value;
+			tree tmp(other.comp_, propagate ? other.value_alloc_ : value_alloc_);
+			tmp.cache_enabled_ = other.cache_enabled_;
+			tmp.assign_sorted(other.begin(), other.end());
+			swap_contents(tmp);
+			std::swap(alloc_, tmp.alloc_);
+			std::swap(value_alloc_, tmp.value_alloc_);
 			return *this;
 		}
 
 		~tree()
 		{
 			destroy(root());
+			release_block();
 		}
 
 	public:
@@ -150,9 +332,15 @@ namespace ft
 		void clear()
 		{
 			destroy(root());
+			release_block();
 			end_node_.left = NULL;
+#ifdef FT_TREE_THREADED
+			end_node_.next = end_node();
+			end_node_.prev = end_node();
+#endif
 			begin_iter_ = end_node();
 			size_ = 0;
+			last_hit_ = NULL;
 		}
 
 		value_compare &value_comp()
@@ -167,6 +355,10 @@ namespace ft
 
 		pair<iterator, bool> insert(const value_type &value)
 		{
+			FT_TREE_STATS_SCOPE(insert);
+			if (cache_enabled_ && cache_lookup(value))
+				return ft::make_pair(iterator(last_hit_), false);
+
 			end_node_pointer parent;
 			node_pointer &child = find_pos(parent, value);
 			bool inserted = false;
@@ -177,12 +369,17 @@ namespace ft
 				it = insert_at(child, parent, value);
 				inserted = true;
 			}
+			else
+				accessed(it.base());
+			if (cache_enabled_)
+				last_hit_ = it.base();
 
 			return ft::make_pair(it, inserted);
 		}
 
 		iterator insert(const_iterator hint, const value_type &value)
 		{
+			FT_TREE_STATS_SCOPE(insert);
 			end_node_pointer parent;
 			node_pointer dummy;
 			node_pointer &child = find_pos(iterator(hint.base()), parent, value, dummy);
@@ -207,12 +404,23 @@ namespace ft
 
 		iterator erase(const_iterator pos)
 		{
+			FT_TREE_STATS_SCOPE(erase);
 			const_iterator next(pos);
 			++next;
 			if (begin_iter_ == pos.base())
 				begin_iter_ = next.base();
+			if (last_hit_ == pos.base())
+				last_hit_ = NULL;
 			node_pointer ptr = pos.node_ptr();
-			tree_remove_node(end_node()->left, ptr);
+#ifdef FT_TREE_THREADED
+			tree_thread_unlink(pos.base());
+#endif
+#ifdef FT_TREE_STATS
+			tree_stats_counter counter(stats_);
+#else
+			tree_null_counter counter;
+#endif
+			Balance::erase(end_node(), ptr, counter);
 			delete_node(ptr);
 			size_--;
 			return iterator(next.base());
@@ -227,6 +435,7 @@ namespace ft
 		template <typename Key>
 		size_type erase(const Key &key)
 		{
+			FT_TREE_STATS_SCOPE(erase);
 			const_iterator it = find(key);
 			if (it == end())
 				return size_type(0);
@@ -234,43 +443,391 @@ namespace ft
 			return size_type(1);
 		}
 
-		void swap(tree &other)
+		/**
+		 * @brief treap_balance only: moves every element not less than key into greater, whose
+		 * previous elements are destroyed. The cut walks one path, O(log n); the moved elements
+		 * are counted from the cut outwards, O(min(k, n - k)) for k of them. When nodes cannot
+		 * change hands (a compact() block, allocators comparing unequal) they are copied instead.
+		 * Splitting into the tree itself does nothing.
+		 */
+		template <typename Key>
+		void split(const Key &key, tree &greater)
 		{
-			std::swap(begin_iter_, other.begin_iter_);
-			std::swap(end_node_, other.end_node_);
-			std::swap(size_, other.size_);
-			std::swap(comp_, other.comp_);
-			if (size() == 0)
+			if (&greater == this)
+				return;
+			greater.clear();
+			end_node_pointer pos = low_bound(key);
+			if (pos == end_node())
+				return;
+			if (!can_move_nodes(greater))
+			{
+				const const_iterator first(pos);
+				const const_iterator last = end();
+				greater.assign_sorted(first, last);
+				erase(first, last);
+				return;
+			}
+			const size_type moved = count_from(pos);
+#ifdef FT_TREE_THREADED
+			end_node_pointer before = pos->prev;
+			end_node_pointer last = end_node_.prev;
+			before->next = end_node();
+			end_node_.prev = before;
+			pos->prev = greater.end_node();
+			last->next = greater.end_node();
+			greater.end_node_.next = pos;
+			greater.end_node_.prev = last;
+#endif
+			node_pointer right = Balance::split(end_node(), static_cast<node_pointer>(pos), comp_);
+			greater.end_node_.left = right;
+			right->parent = greater.end_node();
+			greater.begin_iter_ = pos;
+			greater.size_ = moved;
+			size_ -= moved;
+			if (begin_iter_ == pos)
 				begin_iter_ = end_node();
-			else
-				end_node()->left->parent = end_node();
-			if (other.size() == 0)
-				other.begin_iter_ = other.end_node();
-			else
-				other.end_node()->left->parent = other.end_node();
+			last_hit_ = NULL;
+#ifdef FT_TREE_STATS
+			stats_.bytes_in_use -= moved * sizeof(node_type);
+			greater.stats_.bytes_in_use += moved * sizeof(node_type);
+#endif
+		}
+
+		/**
+		 * @brief treap_balance only: moves every element of greater into the tree, leaving it
+		 * empty. O(log n) when all of greater's keys follow the tree's; otherwise, or when split
+		 * would copy, the elements are inserted one by one and those already present dropped.
+		 */
+		void join(tree &greater)
+		{
+			if (&greater == this || greater.size_ == 0)
+				return;
+			if (!can_move_nodes(greater) || (size_ != 0 && !comp_(*--end(), *greater.begin())))
+			{
+				insert(greater.begin(), greater.end());
+				greater.clear();
+				return;
+			}
+#ifdef FT_TREE_THREADED
+			end_node_pointer last = end_node_.prev;
+			last->next = greater.end_node_.next;
+			greater.end_node_.next->prev = last;
+			greater.end_node_.prev->next = end_node();
+			end_node_.prev = greater.end_node_.prev;
+			greater.end_node_.next = greater.end_node();
+			greater.end_node_.prev = greater.end_node();
+#endif
+			if (size_ == 0)
+				begin_iter_ = greater.begin_iter_;
+			Balance::join(end_node(), greater.root());
+			size_ += greater.size_;
+			last_hit_ = NULL;
+#ifdef FT_TREE_STATS
+			stats_.bytes_in_use += greater.size_ * sizeof(node_type);
+			greater.stats_.bytes_in_use -= greater.size_ * sizeof(node_type);
+#endif
+			greater.end_node_.left = NULL;
+			greater.begin_iter_ = greater.end_node();
+			greater.size_ = 0;
+			greater.last_hit_ = NULL;
+		}
+
+		// Allocators are exchanged only when they propagate on swap, see allocator_traits
+		void swap(tree &other)
+		{
+			if (alloc_traits::propagate_on_container_swap::value)
+			{
+				std::swap(alloc_, other.alloc_);
+				std::swap(value_alloc_, other.value_alloc_);
+			}
+			swap_contents(other);
 		}
 		
+		/**
+		 * @brief Last-hit cache: when enabled, find/count/insert first compare the key with the
+		 * element found by the previous lookup. Pays off for repeated-key lookups only, so it is
+		 * off by default; check lookup_cache_stats() to see whether it does. Lookups through a
+		 * const tree update the cache too, so an enabled cache must not be shared between threads.
+		 */
+		void enable_lookup_cache(bool enabled)
+		{
+			cache_enabled_ = enabled;
+			last_hit_ = NULL;
+		}
+
+		bool lookup_cache_enabled() const
+		{
+			return cache_enabled_;
+		}
+
+		const tree_cache_stats &lookup_cache_stats() const
+		{
+			return cache_stats_;
+		}
+
+		void reset_lookup_cache_stats()
+		{
+			cache_stats_ = tree_cache_stats();
+		}
+
+#ifdef FT_TREE_STATS
+		/**
+		 * @brief Counters of an FT_TREE_STATS build. The current height is measured here, by a
+		 * walk over the whole tree. Lookups through a const tree update the counters too, so a
+		 * stats build must not be read from several threads at once.
+		 */
+		tree_stats stats() const
+		{
+			stats_.height = static_cast<std::size_t>(subtree_height(root()));
+			stats_.max_height = std::max(stats_.max_height, stats_.height);
+			return stats_;
+		}
+
+		// Zeroes the counters; bytes_in_use and the height describe the current tree and stay
+		void reset_stats()
+		{
+			tree_stats fresh;
+			fresh.bytes_in_use = stats_.bytes_in_use;
+			fresh.height = static_cast<std::size_t>(subtree_height(root()));
+			fresh.max_height = fresh.height;
+			stats_ = fresh;
+		}
+#endif
+
+		/**
+		 * @brief Finger search: starts from `finger` instead of the root and only climbs until the
+		 * subtree that must contain the key, so lookups close to the previous one cost O(log d)
+		 * where d is the distance between the two keys.
+		 *
+		 * @link https://en.wikipedia.org/wiki/Finger_search @endlink
+		 */
+		template <typename Key>
+		iterator find(const_iterator finger, const Key &key)
+		{
+			FT_TREE_STATS_SCOPE(lookup);
+			end_node_pointer pos;
+			end_node_pointer ptr = find_from(finger_start(finger.base(), key, pos), key);
+			return ptr == NULL ? end() : iterator(ptr);
+		}
+
+		template <typename Key>
+		const_iterator find(const_iterator finger, const Key &key) const
+		{
+			FT_TREE_STATS_SCOPE(lookup);
+			end_node_pointer pos;
+			end_node_pointer ptr = find_from(finger_start(finger.base(), key, pos), key);
+			return ptr == NULL ? end() : const_iterator(ptr);
+		}
+
+		template <typename Key>
+		iterator lower_bound(const_iterator finger, const Key &key)
+		{
+			FT_TREE_STATS_SCOPE(lookup);
+			end_node_pointer pos;
+			node_pointer start = finger_start(finger.base(), key, pos);
+			return iterator(low_bound_from(start, pos, key));
+		}
+
+		template <typename Key>
+		const_iterator lower_bound(const_iterator finger, const Key &key) const
+		{
+			FT_TREE_STATS_SCOPE(lookup);
+			end_node_pointer pos;
+			node_pointer start = finger_start(finger.base(), key, pos);
+			return const_iterator(low_bound_from(start, pos, key));
+		}
+
+		/**
+		 * @brief Moves every node into one contiguous block, in the given order, and frees the old
+		 * nodes. After a long run of random inserts and erases the nodes are scattered over the
+		 * heap; compacting a read-mostly tree during a quiet period makes lookups and scans touch
+		 * far fewer cache lines. Invalidates every iterator.
+		 *
+		 * Nodes erased later are kept as holes of the block and reused by the next insertions.
+		 *
+		 * @link https://en.wikipedia.org/wiki/Locality_of_reference @endlink
+		 */
+		void compact(tree_layout layout = tree_layout_bfs)
+		{
+			if (size_ == 0)
+			{
+				release_block();
+				return;
+			}
+
+			vector<node_pointer> order;
+			order.reserve(size_);
+			if (layout == tree_layout_bfs)
+			{
+				order.push_back(root());
+				for (size_type i = 0; i < order.size(); ++i)
+				{
+					if (order[i]->left != NULL)
+						order.push_back(order[i]->left);
+					if (order[i]->right != NULL)
+						order.push_back(order[i]->right);
+				}
+			}
+			else
+			{
+				for (iterator it = begin(); it != end(); ++it)
+					order.push_back(it.node_ptr());
+			}
+
+			node_pointer block = allocate_nodes(size_);
+			size_type built = 0;
+			try
+			{
+				for (; built < size_; ++built)
+					value_alloc_.construct(&block[built].value, order[built]->value);
+			}
+			catch (...)
+			{
+				while (built > 0)
+					value_alloc_.destroy(&block[--built].value);
+				deallocate_nodes(block, size_);
+				throw;
+			}
+
+			// Copy the old links, then leave a forwarding address in each old node's parent
+			for (size_type i = 0; i < size_; ++i)
+			{
+				block[i].left = order[i]->left;
+				block[i].right = order[i]->right;
+				block[i].parent = order[i]->parent;
+				block[i].is_black = order[i]->is_black;
+				block[i].balance = order[i]->balance;
+#ifdef FT_TREE_THREADED
+				block[i].next = order[i]->next;
+				block[i].prev = order[i]->prev;
+#endif
+			}
+			for (size_type i = 0; i < size_; ++i)
+				order[i]->parent = static_cast<end_node_pointer>(&block[i]);
+			for (size_type i = 0; i < size_; ++i)
+			{
+				if (block[i].left != NULL)
+					block[i].left = static_cast<node_pointer>(block[i].left->parent);
+				if (block[i].right != NULL)
+					block[i].right = static_cast<node_pointer>(block[i].right->parent);
+				block[i].parent = forward(block[i].parent);
+#ifdef FT_TREE_THREADED
+				block[i].next = forward(block[i].next);
+				block[i].prev = forward(block[i].prev);
+#endif
+			}
+			end_node_.left = static_cast<node_pointer>(root()->parent);
+#ifdef FT_TREE_THREADED
+			end_node_.next = forward(end_node_.next);
+			end_node_.prev = forward(end_node_.prev);
+#endif
+			begin_iter_ = forward(begin_iter_);
+			last_hit_ = NULL;
+
+			for (size_type i = 0; i < size_; ++i)
+			{
+				value_alloc_.destroy(&order[i]->value);
+				if (!in_block(order[i]))
+					deallocate_nodes(order[i], 1);
+			}
+			release_block();
+			block_ = block;
+			block_size_ = size_;
+		}
+
+		// Compacts in the layout suited to lookups, for read-mostly trees
+		void freeze()
+		{
+			compact(tree_layout_bfs);
+		}
+
+		/**
+		 * @brief Replaces the content with [first, last), which must be sorted and free of
+		 * duplicates, in O(n) instead of O(n log n): the nodes are built in order and linked as a
+		 * balanced tree by splitting at the middle. Every level but the deepest is full, and the
+		 * balancing policy sets up its node data from there (colors, heights, priorities).
+		 */
+		template <typename ForwardIt>
+		void assign_sorted(ForwardIt first, ForwardIt last)
+		{
+			clear();
+			const size_type count = std::distance(first, last);
+			if (count == 0)
+				return;
+
+			vector<node_pointer> nodes;
+			nodes.reserve(count);
+			try
+			{
+				for (; first != last; ++first)
+					nodes.push_back(construct_node(*first));
+			}
+			catch (...)
+			{
+				for (size_type i = 0; i < nodes.size(); ++i)
+					delete_node(nodes[i]);
+				throw;
+			}
+
+			size_type full_levels = 0; // floor(log2(count + 1))
+			while ((size_type(2) << full_levels) - 1 <= count)
+				++full_levels;
+			end_node_.left = link_sorted(nodes, 0, count, end_node(), 0, full_levels);
+#ifdef FT_TREE_THREADED
+			for (size_type i = 0; i < count; ++i)
+				tree_thread_link_before(static_cast<end_node_pointer>(nodes[i]), end_node());
+#endif
+			begin_iter_ = static_cast<end_node_pointer>(nodes[0]);
+			size_ = count;
+		}
+
 		template <typename Key>
 		size_type count(const Key &key) const
 		{
+			FT_TREE_STATS_SCOPE(lookup);
 			return find_pointer(key) == NULL ? size_type(0) : size_type(1);
 		}
 
 		template <typename Key>
 		iterator find(const Key &key)
 		{
+			FT_TREE_STATS_SCOPE(lookup);
 			return find_key<iterator>(key);
 		}
 
 		template <typename Key>
 		const_iterator find(const Key &key) const
 		{
+			FT_TREE_STATS_SCOPE(lookup);
 			return find_key<const_iterator>(key);
 		}
 
+		/**
+		 * @brief Looks up every key of [first, last) and writes one iterator per key to out, end()
+		 * for the missing ones. A single find is a chain of dependent cache misses; here up to
+		 * batch_width descents advance in lockstep and each one prefetches its next node, so the
+		 * misses of different keys overlap instead of adding up.
+		 *
+		 * First and last must be forward iterators: keys are referenced while in flight.
+		 *
+		 * @link https://www.vldb.org/pvldb/vol9/p252-kocberber.pdf @endlink
+		 */
+		template <typename ForwardIt, typename OutputIt>
+		OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+		{
+			return batch_lookup<iterator>(first, last, out);
+		}
+
+		template <typename ForwardIt, typename OutputIt>
+		OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+		{
+			return batch_lookup<const_iterator>(first, last, out);
+		}
+
 		template <typename Key>
 		pair<iterator, iterator> equal_range(const Key &key)
 		{
+			FT_TREE_STATS_SCOPE(lookup);
 			pair<end_node_pointer, end_node_pointer> range = eq_range(key);
 			return ft::make_pair(iterator(range.first), iterator(range.second));
 		}
@@ -278,6 +835,7 @@ namespace ft
 		template <typename Key>
 		pair<const_iterator, const_iterator> equal_range(const Key &key) const
 		{
+			FT_TREE_STATS_SCOPE(lookup);
 			pair<end_node_pointer, end_node_pointer> range = eq_range(key);
 			return ft::make_pair(const_iterator(range.first), const_iterator(range.second));
 		}
@@ -285,24 +843,28 @@ namespace ft
 		template <typename Key>
 		iterator lower_bound(const Key &key)
 		{
+			FT_TREE_STATS_SCOPE(lookup);
 			return iterator(low_bound(key));
 		}
 
 		template <typename Key>
 		const_iterator lower_bound(const Key &key) const
 		{
+			FT_TREE_STATS_SCOPE(lookup);
 			return const_iterator(low_bound(key));
 		}
 
 		template <typename Key>
 		iterator upper_bound(const Key &key)
 		{
+			FT_TREE_STATS_SCOPE(lookup);
 			return iterator(up_bound(key));
 		}
 
 		template <typename Key>
 		const_iterator upper_bound(const Key &key) const
 		{
+			FT_TREE_STATS_SCOPE(lookup);
 			return const_iterator(up_bound(key));
 		}
 
@@ -315,14 +877,72 @@ namespace ft
 			return ptr == NULL ? Iter(end_node()) : Iter(ptr);
 		}
 
+		template <typename Iter, typename ForwardIt, typename OutputIt>
+		OutputIt batch_lookup(ForwardIt first, ForwardIt last, OutputIt out) const
+		{
+			typedef typename std::iterator_traits<ForwardIt>::value_type key_type;
+			const size_type batch_width = 16;
+			const key_type *keys[batch_width];
+			node_pointer cur[batch_width];
+			end_node_pointer found[batch_width];
+
+			while (first != last)
+			{
+				FT_TREE_STATS_SCOPE(lookup);
+				size_type count = 0;
+				for (; count < batch_width && first != last; ++count, ++first)
+				{
+					keys[count] = &*first;
+					cur[count] = root();
+					found[count] = end_node();
+				}
+
+				size_type active = root() == NULL ? 0 : count;
+				while (active != 0)
+				{
+					for (size_type i = 0; i < count; ++i)
+					{
+						node_pointer node = cur[i];
+						if (node == NULL)
+							continue;
+						if (compare(*keys[i], node->value))
+							node = node->left;
+						else if (compare(node->value, *keys[i]))
+							node = node->right;
+						else
+						{
+							found[i] = static_cast<end_node_pointer>(node);
+							node = NULL;
+						}
+						cur[i] = node;
+						if (node != NULL)
+							tree_prefetch(node);
+						else
+							--active;
+					}
+				}
+
+				for (size_type i = 0; i < count; ++i, ++out)
+					*out = Iter(found[i]);
+#ifdef FT_TREE_STATS
+				stats_.lookups += count - 1; // The scope counted the batch as one lookup
+#endif
+			}
+			return out;
+		}
+
 		template <typename Key>
 		end_node_pointer low_bound(const Key &key) const
 		{
-			node_pointer ptr = root();
-			end_node_pointer pos = end_node();
+			return low_bound_from(root(), end_node(), key);
+		}
+
+		template <typename Key>
+		end_node_pointer low_bound_from(node_pointer ptr, end_node_pointer pos, const Key &key) const
+		{
 			while (ptr != NULL)
 			{
-				if (!value_comp()(ptr->value, key))
+				if (!compare(ptr->value, key))
 				{
 					pos = static_cast<end_node_pointer>(ptr);
 					ptr = ptr->left;
@@ -340,7 +960,7 @@ namespace ft
 			end_node_pointer pos = end_node();
 			while (ptr != NULL)
 			{
-				if (value_comp()(key, ptr->value))
+				if (compare(key, ptr->value))
 				{
 					pos = static_cast<end_node_pointer>(ptr);
 					ptr = ptr->left;
@@ -359,12 +979,12 @@ namespace ft
 			end_node_pointer up = end_node();
 			while (ptr != NULL)
 			{
-				if (value_comp()(key, ptr->value))
+				if (compare(key, ptr->value))
 				{
 					up = low = static_cast<end_node_pointer>(ptr);
 					ptr = ptr->left;
 				}
-				else if (value_comp()(ptr->value, key))
+				else if (compare(ptr->value, key))
 					ptr = ptr->right;
 				else
 				{
@@ -377,18 +997,110 @@ namespace ft
 			return ft::make_pair(low, up);
 		}
 
+		// Everything but the allocators
+		void swap_contents(tree &other)
+		{
+			std::swap(begin_iter_, other.begin_iter_);
+			std::swap(end_node_, other.end_node_);
+			std::swap(size_, other.size_);
+			std::swap(comp_, other.comp_);
+			std::swap(block_, other.block_);
+			std::swap(block_size_, other.block_size_);
+			std::swap(holes_, other.holes_);
+			std::swap(cache_enabled_, other.cache_enabled_);
+			std::swap(cache_stats_, other.cache_stats_);
+#ifdef FT_TREE_STATS
+			std::swap(stats_, other.stats_);
+#endif
+			last_hit_ = NULL;
+			other.last_hit_ = NULL;
+			if (size() == 0)
+				begin_iter_ = end_node();
+			else
+				end_node()->left->parent = end_node();
+			if (other.size() == 0)
+				other.begin_iter_ = other.end_node();
+			else
+				other.end_node()->left->parent = other.end_node();
+#ifdef FT_TREE_THREADED
+			relink_end_node();
+			other.relink_end_node();
+#endif
+		}
+
+#ifdef FT_TREE_THREADED
+		// The end node moved (swap): point the ends of the in-order list back at it
+		void relink_end_node()
+		{
+			if (size_ == 0)
+			{
+				end_node_.next = end_node();
+				end_node_.prev = end_node();
+				return;
+			}
+			end_node_.next->prev = end_node();
+			end_node_.prev->next = end_node();
+		}
+#endif
+
+		// Links nodes[lo, hi) as the subtree under parent, its root at the given depth
+		node_pointer link_sorted(const vector<node_pointer> &nodes, size_type lo, size_type hi,
+								 end_node_pointer parent, size_type depth, size_type full_levels)
+		{
+			if (lo == hi)
+				return NULL;
+			const size_type mid = lo + (hi - lo) / 2;
+			node_pointer node = nodes[mid];
+			node->parent = parent;
+			node->left = link_sorted(nodes, lo, mid, static_cast<end_node_pointer>(node), depth + 1, full_levels);
+			node->right = link_sorted(nodes, mid + 1, hi, static_cast<end_node_pointer>(node), depth + 1, full_levels);
+			Balance::on_build(node, depth, full_levels);
+			return node;
+		}
+
 		iterator insert_at(node_pointer &pos, end_node_pointer parent, const value_type &value)
 		{
 			pos = construct_node(value);
 			pos->parent = parent;
+#ifdef FT_TREE_THREADED
+			// A new leaf sits right before its parent when it is a left child, right after otherwise
+			if (parent->left == pos)
+				tree_thread_link_before(static_cast<end_node_pointer>(pos), parent);
+			else
+				tree_thread_link_after(static_cast<end_node_pointer>(pos), parent);
+#endif
 			if (begin_iter_->left != NULL)
 				begin_iter_ = begin_iter_->left;
 			++size_;
 			node_pointer ptr = pos;
-			tree_insert_fix(end_node()->left, ptr);
+#ifdef FT_TREE_STATS
+			stats_.max_height = std::max(stats_.max_height, static_cast<std::size_t>(depth(ptr)));
+			tree_stats_counter counter(stats_);
+#else
+			tree_null_counter counter;
+#endif
+			Balance::after_insert(end_node(), ptr, counter);
 			return iterator(ptr);
 		}
 
+#ifdef FT_TREE_STATS
+		static size_type subtree_height(node_pointer node)
+		{
+			if (node == NULL)
+				return 0;
+			return 1 + std::max(subtree_height(node->left), subtree_height(node->right));
+		}
+
+		// Nodes on the path from the root to node, both included
+		size_type depth(node_pointer node) const
+		{
+			size_type levels = 1;
+			for (; node != root(); node = node->get_parent())
+				++levels;
+			return levels;
+		}
+#endif
+
 		node_pointer root() const
 		{
 			return end_node()->left;
@@ -409,12 +1121,102 @@ namespace ft
 			return const_cast<end_node_pointer>(&end_node_);
 		}
 
+		// During compact(): where the node that was at ptr lives now
+		end_node_pointer forward(end_node_pointer ptr) const
+		{
+			if (ptr == end_node())
+				return ptr;
+			return static_cast<node_pointer>(ptr)->parent;
+		}
+
+		// Nodes can be relinked into other: same allocator, and neither tree owns a node block
+		bool can_move_nodes(const tree &other) const
+		{
+			return block_ == NULL && other.block_ == NULL && value_alloc_ == other.value_alloc_;
+		}
+
+		// Elements in [pos, end()), walking from pos both ways so the cost is the smaller side's
+		size_type count_from(end_node_pointer pos) const
+		{
+			const_iterator forward(pos);
+			const_iterator backward(pos);
+			const const_iterator first = begin();
+			const const_iterator last = end();
+			size_type after = 0;
+			size_type before = 0;
+			while (true)
+			{
+				if (forward == last)
+					return after;
+				if (backward == first)
+					return size_ - before;
+				++forward;
+				++after;
+				--backward;
+				++before;
+			}
+		}
+
+		bool in_block(node_pointer node) const
+		{
+			std::less<node_pointer> less;
+			return block_ != NULL && !less(node, block_) && less(node, block_ + block_size_);
+		}
+
+		// Only once every node of the block has been destroyed
+		void release_block()
+		{
+			if (block_ != NULL)
+				deallocate_nodes(block_, block_size_);
+			block_ = NULL;
+			block_size_ = 0;
+			holes_ = NULL;
+		}
+
+		node_pointer allocate_nodes(size_type count)
+		{
+			node_pointer nodes = alloc_.allocate(count);
+#ifdef FT_TREE_STATS
+			++stats_.allocations;
+			stats_.bytes_in_use += count * sizeof(node_type);
+#endif
+			return nodes;
+		}
+
+		void deallocate_nodes(node_pointer nodes, size_type count)
+		{
+			alloc_.deallocate(nodes, count);
+#ifdef FT_TREE_STATS
+			++stats_.deallocations;
+			stats_.bytes_in_use -= count * sizeof(node_type);
+#endif
+		}
+
+		// Comparator calls of the tree all go through here, so FT_TREE_STATS can count them
+		template <typename L, typename R>
+		bool compare(const L &lhs, const R &rhs) const
+		{
+#ifdef FT_TREE_STATS
+			++stats_.comparisons;
+#endif
+			return comp_(lhs, rhs);
+		}
+
 		node_pointer construct_node(const value_type &value)
 		{
-			node_pointer new_node = alloc_.allocate(1);
+			node_pointer new_node;
+			if (holes_ != NULL)
+			{
+				new_node = holes_;
+				holes_ = holes_->right;
+			}
+			else
+				new_node = allocate_nodes(1);
 			new_node->left = NULL;
 			new_node->right = NULL;
 			new_node->parent = NULL;
+			new_node->is_black = false;
+			new_node->balance = 0;
 			value_alloc_.construct(&new_node->value, value);
 			return new_node;
 		}
@@ -422,12 +1224,93 @@ namespace ft
 		template <typename Key>
 		end_node_pointer find_pointer(const Key &key) const
 		{
-			node_pointer ptr = root();
+			if (cache_enabled_ && cache_lookup(key))
+				return last_hit_;
+			end_node_pointer ptr = find_from(root(), key);
+			if (ptr != NULL)
+			{
+				accessed(ptr);
+				if (cache_enabled_)
+					last_hit_ = ptr;
+			}
+			return ptr;
+		}
+
+		// Lets the balancing policy restructure around a node a lookup found (splay)
+		void accessed(end_node_pointer ptr) const
+		{
+#ifdef FT_TREE_STATS
+			tree_stats_counter counter(stats_);
+#else
+			tree_null_counter counter;
+#endif
+			Balance::on_access(end_node(), static_cast<node_pointer>(ptr), counter);
+		}
+
+		// Counts a hit when key matches the last hit, a miss otherwise
+		template <typename Key>
+		bool cache_lookup(const Key &key) const
+		{
+			if (last_hit_ != NULL)
+			{
+				const value_type &cached = static_cast<node_pointer>(last_hit_)->value;
+				if (!compare(key, cached) && !compare(cached, key))
+				{
+					++cache_stats_.hits;
+					return true;
+				}
+			}
+			++cache_stats_.misses;
+			return false;
+		}
+
+		/**
+		 * @brief Climbs from the finger to the lowest ancestor whose subtree covers key. On the way
+		 * it sets pos to an element known to be greater or equal than key (or end()), which is
+		 * where a lower_bound descent of that subtree starts.
+		 */
+		template <typename Key>
+		node_pointer finger_start(end_node_pointer finger, const Key &key, end_node_pointer &pos) const
+		{
+			pos = end_node();
+			if (finger == end_node() || root() == NULL)
+				return root();
+
+			node_pointer node = static_cast<node_pointer>(finger);
+			if (compare(key, node->value))
+			{
+				// The finger is an upper bound: climb until a right turn comes from below key
+				pos = finger;
+				while (node != root()
+					   && (tree_is_left_child(node) || !compare(node->get_parent()->value, key)))
+					node = node->get_parent();
+			}
+			else if (!compare(node->value, key))
+				pos = finger;
+			else
+			{
+				// Key is after the finger: climb until a left turn comes from above key
+				while (node != root())
+				{
+					if (tree_is_left_child(node) && compare(key, node->get_parent()->value))
+					{
+						pos = node->parent;
+						break;
+					}
+					node = node->get_parent();
+				}
+			}
+			return node;
+		}
+
+		template <typename Key>
+		end_node_pointer find_from(node_pointer ptr, const Key &key) const
+		{
 			while (ptr != NULL)
 			{
-				if (value_comp()(key, ptr->value))
+				if (compare(key, ptr->value))
 					ptr = ptr->left;
-				else if (value_comp()(ptr->value, key))
+				else if (compare(ptr->value, key))
 					ptr = ptr->right;
 				else
 					return static_cast<end_node_pointer>(ptr);
@@ -442,7 +1325,7 @@ namespace ft
 			node_pointer *ptr = root_ptr();
 			while (node != NULL)
 			{
-				if (value_comp()(key, node->value))
+				if (compare(key, node->value))
 				{
 					if (node->left != NULL)
 					{
@@ -455,7 +1338,7 @@ namespace ft
 						return node->left;
 					}
 				}
-				else if (value_comp()(node->value, key))
+				else if (compare(node->value, key))
 				{
 					if (node->right != NULL)
 					{
@@ -482,10 +1365,10 @@ namespace ft
 		node_pointer &find_pos(iterator hint, end_node_pointer &parent, const Key &key,
 							   node_pointer &dummy) const
 		{
-			if (hint == end() || value_comp()(key, *hint))
+			if (hint == end() || compare(key, *hint))
 			{
 				const_iterator prev = hint;
-				if (prev == begin() || value_comp()(*--prev, key))
+				if (prev == begin() || compare(*--prev, key))
 				{
 					if (hint.base()->left == NULL)
 					{
@@ -500,11 +1383,11 @@ namespace ft
 				}
 				return find_pos(parent, key);
 			}
-			else if (value_comp()(*hint, key))
+			else if (compare(*hint, key))
 			{
 				const_iterator next = hint;
 				++next;
-				if (next == end() || value_comp()(key, *next))
+				if (next == end() || compare(key, *next))
 				{
 					if (hint.node_ptr()->right == NULL)
 					{
@@ -527,17 +1410,39 @@ namespace ft
 		void delete_node(node_pointer node)
 		{
 			value_alloc_.destroy(&node->value);
-			alloc_.deallocate(node, 1);
+			if (in_block(node))
+			{
+				node->right = holes_;
+				holes_ = node;
+			}
+			else
+				deallocate_nodes(node, 1);
 		}
 
+		// Rotates left children up until there are none, so no recursion as deep as the tree:
+		// a splay tree can be a path of all its nodes
 		void destroy(node_pointer node)
 		{
-			if (node != NULL)
+#ifndef FT_TREE_STATS
+			// Nothing to run or free per node: the arena takes the memory back at once
+			if (is_trivially_destructible<value_type>::value && alloc_traits::deallocation_is_noop(value_alloc_))
+				return;
+#endif
+			while (node != NULL)
 			{
-				destroy(node->left);
-				destroy(node->right);
-				value_alloc_.destroy(&node->value);
-				alloc_.deallocate(node, 1);
+				if (node->left != NULL)
+				{
+					node_pointer left = node->left;
+					node->left = left->right;
+					left->right = node;
+					node = left;
+				}
+				else
+				{
+					node_pointer next = node->right;
+					delete_node(node);
+					node = next;
+				}
 			}
 		}
 	};
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tree_access.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:02:37 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 14:02:37 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TREE_ACCESS_HPP
+# define TREE_ACCESS_HPP
+
+# include "tree_types.hpp"
+
+namespace ft
+{
+    /**
+     * @brief Friend of ft::map and ft::tree, the only way for free algorithms to reach the tree
+     * behind a map and its nodes. Kept in one place so the containers' public interface stays the
+     * standard one.
+     */
+    struct tree_access
+    {
+        // The tree type behind a map
+        template <typename Map>
+        struct tree_of
+        {
+            typedef typename Map::base type;
+        };
+
+        template <typename Map>
+        static typename Map::base &tree(Map &m)
+        {
+            return m.tree_;
+        }
+
+        template <typename Map>
+        static const typename Map::base &tree(const Map &m)
+        {
+            return m.tree_;
+        }
+
+        // Replaces the elements of a map with sorted, unique values in O(n), see map::replace_sorted
+        template <typename Map, typename ForwardIt>
+        static void replace_sorted(Map &m, ForwardIt first, ForwardIt last)
+        {
+            m.replace_sorted(first, last);
+        }
+
+        template <typename Tree>
+        static typename Tree::node_pointer root(const Tree &t)
+        {
+            return t.root();
+        }
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
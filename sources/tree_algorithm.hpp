@@ -20,6 +20,16 @@
 
 namespace ft
 {
+    // Asks the CPU to start loading the cache line of ptr, a no-op for compilers without the builtin
+    inline void tree_prefetch(const void *ptr)
+    {
+#if defined(__GNUC__)
+        __builtin_prefetch(ptr);
+#else
+        (void)ptr;
+#endif
+    }
+
     template <typename NodePtr>
     inline bool tree_is_left_child(NodePtr ptr)
     {
@@ -67,6 +77,35 @@ namespace ft
         return nptr->parent;
     }
 
+#ifdef FT_TREE_THREADED
+    // Threaded layout: puts node in the in-order list right before pos
+    template <typename EndNodePtr>
+    void tree_thread_link_before(EndNodePtr node, EndNodePtr pos)
+    {
+        node->next = pos;
+        node->prev = pos->prev;
+        pos->prev->next = node;
+        pos->prev = node;
+    }
+
+    // Threaded layout: puts node in the in-order list right after pos
+    template <typename EndNodePtr>
+    void tree_thread_link_after(EndNodePtr node, EndNodePtr pos)
+    {
+        node->prev = pos;
+        node->next = pos->next;
+        pos->next->prev = node;
+        pos->next = node;
+    }
+
+    template <typename EndNodePtr>
+    void tree_thread_unlink(EndNodePtr node)
+    {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+#endif
+
     template <typename NodePtr>
     void tree_rotate_left(NodePtr node)
     {
@@ -125,8 +164,31 @@ namespace ft
         return false;
     }
 
-    template <typename NodePtr>
-    void tree_insert_fix(NodePtr root, NodePtr z)
+    /**
+     * @brief Counter of the rebalancing work done by tree_insert_fix / tree_delete_fix. This one
+     * does nothing and is what the plain overloads use, so they compile to the uncounted code;
+     * ft::tree passes a real counter in FT_TREE_STATS builds.
+     */
+    struct tree_null_counter
+    {
+        void rotation()
+        {
+        }
+
+        void recoloring(bool)
+        {
+        }
+    };
+
+    template <typename NodePtr, typename Counter>
+    inline void tree_paint(NodePtr node, bool black, Counter &counter)
+    {
+        counter.recoloring(node->is_black != black);
+        node->is_black = black;
+    }
+
+    template <typename NodePtr, typename Counter>
+    void tree_insert_fix(NodePtr root, NodePtr z, Counter &counter)
     {
         z->is_black = z == root;
         while (z != root && !z->get_parent()->is_black)
@@ -136,11 +198,11 @@ namespace ft
                 NodePtr uncle = z->get_parent()->get_parent()->right;
                 if (!tree_node_is_black(uncle))
                 {
-                    uncle->is_black = true;
+                    tree_paint(uncle, true, counter);
                     z = z->get_parent();
-                    z->is_black = true;
+                    tree_paint(z, true, counter);
                     z = z->get_parent();
-                    z->is_black = z == root;
+                    tree_paint(z, z == root, counter);
                 }
                 else
                 {
@@ -148,13 +210,15 @@ namespace ft
                     {
                         z = z->get_parent();
                         tree_rotate_left(z);
+                        counter.rotation();
                     }
 
                     z = z->get_parent();
-                    z->is_black = true;
+                    tree_paint(z, true, counter);
                     z = z->get_parent();
-                    z->is_black = false;
+                    tree_paint(z, false, counter);
                     tree_rotate_right(z);
+                    counter.rotation();
                     return;
                 }
             }
@@ -163,11 +227,11 @@ namespace ft
                 NodePtr uncle = z->get_parent()->parent->left;
                 if (!tree_node_is_black(uncle))
                 {
-                    uncle->is_black = true;
+                    tree_paint(uncle, true, counter);
                     z = z->get_parent();
-                    z->is_black = true;
+                    tree_paint(z, true, counter);
                     z = z->get_parent();
-                    z->is_black = z == root;
+                    tree_paint(z, z == root, counter);
                 }
                 else
                 {
@@ -175,12 +239,14 @@ namespace ft
                     {
                         z = z->get_parent();
                         tree_rotate_right(z);
+                        counter.rotation();
                     }
                     z = z->get_parent();
-                    z->is_black = true;
+                    tree_paint(z, true, counter);
                     z = z->get_parent();
-                    z->is_black = false;
+                    tree_paint(z, false, counter);
                     tree_rotate_left(z);
+                    counter.rotation();
                     return;
                 }
             }
@@ -188,7 +254,14 @@ namespace ft
     }
 
     template <typename NodePtr>
-    void tree_delete_fix(NodePtr root, NodePtr x_parent)
+    void tree_insert_fix(NodePtr root, NodePtr z)
+    {
+        tree_null_counter counter;
+        tree_insert_fix(root, z, counter);
+    }
+
+    template <typename NodePtr, typename Counter>
+    void tree_delete_fix(NodePtr root, NodePtr x_parent, Counter &counter)
     {
         NodePtr x = NULL;
         while (root != x && tree_node_is_black(x))
@@ -199,14 +272,15 @@ namespace ft
 
                 if (!w->is_black)
                 {
-                    x_parent->is_black = false;
-                    w->is_black = true;
+                    tree_paint(x_parent, false, counter);
+                    tree_paint(w, true, counter);
                     tree_rotate_left(root, x_parent);
+                    counter.rotation();
                     w = x_parent->right;
                 }
                 if (tree_node_is_black(w->left) && tree_node_is_black(w->right))
                 {
-                    w->is_black = false;
+                    tree_paint(w, false, counter);
                     x = x_parent;
                     x_parent = x->get_parent();
                 }
@@ -214,15 +288,17 @@ namespace ft
                 {
                     if (tree_node_is_black(w->right))
                     {
-                        w->is_black = false;
+                        tree_paint(w, false, counter);
                         tree_rotate_right(root, w);
+                        counter.rotation();
                         w = x_parent->right;
-                        w->is_black = true;
+                        tree_paint(w, true, counter);
                     }
-                    w->is_black = x_parent->is_black;
-                    x_parent->is_black = true;
-                    w->right->is_black = true;
+                    tree_paint(w, x_parent->is_black, counter);
+                    tree_paint(x_parent, true, counter);
+                    tree_paint(w->right, true, counter);
                     tree_rotate_left(root, x_parent);
+                    counter.rotation();
                     x = root;
                     break;
                 }
@@ -233,14 +309,15 @@ namespace ft
 
                 if (!w->is_black)
                 {
-                    x_parent->is_black = false;
-                    w->is_black = true;
+                    tree_paint(x_parent, false, counter);
+                    tree_paint(w, true, counter);
                     tree_rotate_right(root, x_parent);
+                    counter.rotation();
                     w = x_parent->left;
                 }
                 if (tree_node_is_black(w->right) && tree_node_is_black(w->left))
                 {
-                    w->is_black = false;
+                    tree_paint(w, false, counter);
                     x = x_parent;
                     x_parent = x->get_parent();
                 }
@@ -248,22 +325,31 @@ namespace ft
                 {
                     if (tree_node_is_black(w->left))
                     {
-                        w->is_black = false;
+                        tree_paint(w, false, counter);
                         tree_rotate_left(root, w);
+                        counter.rotation();
                         w = x_parent->left;
-                        w->is_black = true;
+                        tree_paint(w, true, counter);
                     }
-                    w->is_black = x_parent->is_black;
-                    x_parent->is_black = true;
-                    w->left->is_black = true;
+                    tree_paint(w, x_parent->is_black, counter);
+                    tree_paint(x_parent, true, counter);
+                    tree_paint(w->left, true, counter);
                     tree_rotate_right(root, x_parent);
+                    counter.rotation();
                     x = root;
                     break;
                 }
             }
         }
         if (x)
-            x->is_black = true;
+            tree_paint(x, true, counter);
+    }
+
+    template <typename NodePtr>
+    void tree_delete_fix(NodePtr root, NodePtr x_parent)
+    {
+        tree_null_counter counter;
+        tree_delete_fix(root, x_parent, counter);
     }
 
     template <typename NodePtr>
@@ -282,8 +368,8 @@ namespace ft
             node->right->set_parent(node);
     }
 
-    template <typename NodePtr>
-    void tree_remove_node(NodePtr root, NodePtr target)
+    template <typename NodePtr, typename Counter>
+    void tree_remove_node(NodePtr root, NodePtr target, Counter &counter)
     {
         NodePtr y = target;
 
@@ -322,12 +408,68 @@ namespace ft
                 return;
             if (x != NULL)
             {
-                x->is_black = true;
+                tree_paint(x, true, counter);
                 return;
             }
-            tree_delete_fix(root, x_parent);
+            tree_delete_fix(root, x_parent, counter);
         }
     }
+
+    template <typename NodePtr>
+    void tree_remove_node(NodePtr root, NodePtr target)
+    {
+        tree_null_counter counter;
+        tree_remove_node(root, target, counter);
+    }
+
+    /**
+     * @brief Plain binary search tree removal, for the balancing policies other than red-black:
+     * target is unlinked and, when it had two children, its successor takes its place (and its
+     * balance data). Returns the lowest node whose subtree lost a node, the end node when the
+     * root was removed.
+     */
+    template <typename T>
+    typename tree_node<T>::end_node_pointer tree_bst_remove(tree_node<T> *target)
+    {
+        typedef typename tree_node<T>::end_node_pointer end_node_pointer;
+        typedef typename tree_node<T>::node_pointer node_pointer;
+
+        const bool left = tree_is_left_child(target);
+        end_node_pointer start;
+        node_pointer replacement;
+        if (target->left == NULL || target->right == NULL)
+        {
+            start = target->parent;
+            replacement = target->left != NULL ? target->left : target->right;
+            if (replacement != NULL)
+                replacement->parent = target->parent;
+        }
+        else
+        {
+            replacement = tree_min(target->right);
+            if (replacement->parent == static_cast<end_node_pointer>(target))
+                start = static_cast<end_node_pointer>(replacement);
+            else
+            {
+                start = replacement->parent;
+                replacement->get_parent()->left = replacement->right;
+                if (replacement->right != NULL)
+                    replacement->right->parent = replacement->parent;
+                replacement->right = target->right;
+                replacement->right->set_parent(replacement);
+            }
+            replacement->left = target->left;
+            replacement->left->set_parent(replacement);
+            replacement->parent = target->parent;
+            replacement->is_black = target->is_black;
+            replacement->balance = target->balance;
+        }
+        if (left)
+            target->parent->left = replacement;
+        else
+            target->get_parent()->right = replacement;
+        return start;
+    }
 } // namespace ft
 
 #endif
\ No newline at end of file
@@ -0,0 +1,366 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tree_balance.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:12:40 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 09:12:40 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TREE_BALANCE_HPP
+# define TREE_BALANCE_HPP
+
+# include <algorithm>
+# include <limits>
+
+# include "hash.hpp"
+# include "tree_algorithm.hpp"
+
+/**
+ * @brief Balancing policies of ft::tree (the Balance parameter of ft::map). A policy is a set of
+ * static hooks called by the tree around its plain binary search tree code:
+ *
+ *  - after_insert(end, node, counter): node was just linked as a leaf
+ *  - erase(end, node, counter): unlink node, which the tree then destroys
+ *  - on_access(end, node, counter): a lookup found node
+ *  - on_build(node, depth, full_levels): assign_sorted linked node, whose subtrees are done
+ *
+ * end is the tree's end node (the root is end->left) and counter receives the rotations and
+ * recolorings for FT_TREE_STATS. Node data lives in tree_node::is_black and tree_node::balance.
+ *
+ *  - rb_balance: red-black tree, the default. Height <= 2 log2(n + 1), O(1) rotations per update.
+ *  - avl_balance: height <= 1.44 log2(n + 2), so shorter searches, for more rotations on updates.
+ *    Suits lookup-heavy maps.
+ *  - treap_balance: random priorities (a hash of the node address) kept in heap order. Expected
+ *    O(log n) depth whatever the insertion order, with the simplest update code. Priorities
+ *    travel with their nodes, so a treap is also the one tree that can be split at a key and
+ *    joined with another in O(log n) (tree::split, tree::join).
+ *  - splay_balance: every insert and successful lookup moves the node to the root. Amortized
+ *    O(log n), and skewed accesses (a few hot keys) stay near the top. Lookups then modify the
+ *    tree: a splay map cannot be read from several threads, even through const references.
+ *
+ * @link https://en.wikipedia.org/wiki/AVL_tree @endlink
+ * @link https://en.wikipedia.org/wiki/Treap @endlink
+ * @link https://en.wikipedia.org/wiki/Splay_tree @endlink
+ */
+
+namespace ft
+{
+    // Moves node one level up, in place of its parent
+    template <typename NodePtr>
+    inline void tree_rotate_up(NodePtr node)
+    {
+        if (tree_is_left_child(node))
+            tree_rotate_right(node->get_parent());
+        else
+            tree_rotate_left(node->get_parent());
+    }
+
+    struct rb_balance
+    {
+        template <typename T, typename Counter>
+        static void after_insert(tree_end_node<T> *end, tree_node<T> *node, Counter &counter)
+        {
+            tree_insert_fix(end->left, node, counter);
+        }
+
+        template <typename T, typename Counter>
+        static void erase(tree_end_node<T> *end, tree_node<T> *node, Counter &counter)
+        {
+            tree_remove_node(end->left, node, counter);
+        }
+
+        template <typename T, typename Counter>
+        static void on_access(tree_end_node<T> *, tree_node<T> *, Counter &)
+        {
+        }
+
+        // Every level but the deepest is full: black above it, red on it
+        template <typename T>
+        static void on_build(tree_node<T> *node, std::size_t depth, std::size_t full_levels)
+        {
+            node->is_black = depth < full_levels;
+        }
+    };
+
+    struct avl_balance
+    {
+        template <typename T, typename Counter>
+        static void after_insert(tree_end_node<T> *end, tree_node<T> *node, Counter &counter)
+        {
+            node->balance = 1;
+            rebalance(end, node->parent, counter);
+        }
+
+        template <typename T, typename Counter>
+        static void erase(tree_end_node<T> *end, tree_node<T> *node, Counter &counter)
+        {
+            rebalance(end, tree_bst_remove(node), counter);
+        }
+
+        template <typename T, typename Counter>
+        static void on_access(tree_end_node<T> *, tree_node<T> *, Counter &)
+        {
+        }
+
+        template <typename T>
+        static void on_build(tree_node<T> *node, std::size_t, std::size_t)
+        {
+            update(node);
+        }
+
+    private:
+        template <typename T>
+        static int height(const tree_node<T> *node)
+        {
+            return node == NULL ? 0 : node->balance;
+        }
+
+        template <typename T>
+        static void update(tree_node<T> *node)
+        {
+            node->balance = 1 + std::max(height(node->left), height(node->right));
+        }
+
+        // Restores the height invariant at node, returns the root of its subtree
+        template <typename T, typename Counter>
+        static tree_node<T> *fix(tree_node<T> *node, Counter &counter)
+        {
+            const int skew = height(node->left) - height(node->right);
+            if (skew > 1)
+            {
+                tree_node<T> *child = node->left;
+                if (height(child->left) < height(child->right))
+                {
+                    tree_node<T> *grandchild = child->right;
+                    tree_rotate_left(child);
+                    counter.rotation();
+                    update(child);
+                    update(grandchild);
+                }
+                tree_node<T> *top = node->left;
+                tree_rotate_right(node);
+                counter.rotation();
+                update(node);
+                update(top);
+                return top;
+            }
+            if (skew < -1)
+            {
+                tree_node<T> *child = node->right;
+                if (height(child->right) < height(child->left))
+                {
+                    tree_node<T> *grandchild = child->left;
+                    tree_rotate_right(child);
+                    counter.rotation();
+                    update(child);
+                    update(grandchild);
+                }
+                tree_node<T> *top = node->right;
+                tree_rotate_left(node);
+                counter.rotation();
+                update(node);
+                update(top);
+                return top;
+            }
+            update(node);
+            return node;
+        }
+
+        // Walks up from the lowest changed subtree until a height stops changing
+        template <typename T, typename Counter>
+        static void rebalance(tree_end_node<T> *end, tree_end_node<T> *start, Counter &counter)
+        {
+            while (start != end)
+            {
+                tree_node<T> *node = static_cast<tree_node<T> *>(start);
+                const int old_height = node->balance;
+                tree_node<T> *top = fix(node, counter);
+                if (top == node && node->balance == old_height)
+                    return;
+                start = top->parent;
+            }
+        }
+    };
+
+    struct treap_balance
+    {
+        template <typename T, typename Counter>
+        static void after_insert(tree_end_node<T> *end, tree_node<T> *node, Counter &counter)
+        {
+            node->balance = priority(node);
+            while (node->parent != end && node->balance > node->get_parent()->balance)
+            {
+                tree_rotate_up(node);
+                counter.rotation();
+            }
+        }
+
+        // Rotates node down below its higher priority child until it can be unlinked
+        template <typename T, typename Counter>
+        static void erase(tree_end_node<T> *, tree_node<T> *node, Counter &counter)
+        {
+            while (node->left != NULL && node->right != NULL)
+            {
+                if (node->left->balance > node->right->balance)
+                    tree_rotate_right(node);
+                else
+                    tree_rotate_left(node);
+                counter.rotation();
+            }
+            tree_bst_remove(node);
+        }
+
+        template <typename T, typename Counter>
+        static void on_access(tree_end_node<T> *, tree_node<T> *, Counter &)
+        {
+        }
+
+        /**
+         * In a treap of random priorities a node holds the largest priority of its subtree, so a
+         * built node takes the largest of its own draw and its children's: heap ordered, and
+         * distributed as if the nodes had been inserted one by one.
+         */
+        template <typename T>
+        static void on_build(tree_node<T> *node, std::size_t, std::size_t)
+        {
+            node->balance = priority(node);
+            if (node->left != NULL)
+                node->balance = std::max(node->balance, node->left->balance);
+            if (node->right != NULL)
+                node->balance = std::max(node->balance, node->right->balance);
+        }
+
+        /**
+         * Cuts the tree under end in two by walking one path: the nodes ordered before pivot stay,
+         * the others (pivot included) are returned as a detached tree, its root's parent unset.
+         * Both halves keep heap order, the tree's size and begin are the caller's business.
+         */
+        template <typename T, typename Compare>
+        static tree_node<T> *split(tree_end_node<T> *end, tree_node<T> *pivot, const Compare &comp)
+        {
+            tree_node<T> *node = end->left;
+            tree_end_node<T> *left_parent = end;
+            tree_node<T> **left_slot = &end->left;
+            tree_node<T> *right_root = NULL;
+            tree_end_node<T> *right_parent = NULL;
+            tree_node<T> **right_slot = &right_root;
+            while (node != NULL)
+            {
+                if (comp(node->value, pivot->value))
+                {
+                    // node and its left subtree stay, its right subtree is cut next
+                    *left_slot = node;
+                    node->parent = left_parent;
+                    left_parent = node;
+                    left_slot = &node->right;
+                    node = node->right;
+                }
+                else
+                {
+                    *right_slot = node;
+                    node->parent = right_parent;
+                    right_parent = node;
+                    right_slot = &node->left;
+                    node = node->left;
+                }
+            }
+            *left_slot = NULL;
+            *right_slot = NULL;
+            return right_root;
+        }
+
+        // Links the detached tree greater, every node of which is ordered after the tree's, under
+        // end by merging the right spine of the tree with the left spine of greater
+        template <typename T>
+        static void join(tree_end_node<T> *end, tree_node<T> *greater)
+        {
+            tree_node<T> *lower = end->left;
+            tree_end_node<T> *parent = end;
+            tree_node<T> **slot = &end->left;
+            while (lower != NULL && greater != NULL)
+            {
+                if (lower->balance > greater->balance)
+                {
+                    *slot = lower;
+                    lower->parent = parent;
+                    parent = lower;
+                    slot = &lower->right;
+                    lower = lower->right;
+                }
+                else
+                {
+                    *slot = greater;
+                    greater->parent = parent;
+                    parent = greater;
+                    slot = &greater->left;
+                    greater = greater->left;
+                }
+            }
+            *slot = lower != NULL ? lower : greater;
+            if (*slot != NULL)
+                (*slot)->parent = parent;
+        }
+
+    private:
+        static int priority(const void *node)
+        {
+            return static_cast<int>(hash_mix(reinterpret_cast<std::size_t>(node)) &
+                                    static_cast<std::size_t>(std::numeric_limits<int>::max()));
+        }
+    };
+
+    struct splay_balance
+    {
+        template <typename T, typename Counter>
+        static void after_insert(tree_end_node<T> *end, tree_node<T> *node, Counter &counter)
+        {
+            splay(end, node, counter);
+        }
+
+        template <typename T, typename Counter>
+        static void erase(tree_end_node<T> *end, tree_node<T> *node, Counter &counter)
+        {
+            tree_end_node<T> *parent = tree_bst_remove(node);
+            if (parent != end)
+                splay(end, static_cast<tree_node<T> *>(parent), counter);
+        }
+
+        template <typename T, typename Counter>
+        static void on_access(tree_end_node<T> *end, tree_node<T> *node, Counter &counter)
+        {
+            splay(end, node, counter);
+        }
+
+        template <typename T>
+        static void on_build(tree_node<T> *, std::size_t, std::size_t)
+        {
+        }
+
+    private:
+        // Zig-zig rotates the grandparent first, which roughly halves the depth of the path
+        template <typename T, typename Counter>
+        static void splay(tree_end_node<T> *end, tree_node<T> *node, Counter &counter)
+        {
+            while (node->parent != end)
+            {
+                tree_node<T> *parent = node->get_parent();
+                if (parent->parent != end)
+                {
+                    if (tree_is_left_child(node) == tree_is_left_child(parent))
+                        tree_rotate_up(parent);
+                    else
+                        tree_rotate_up(node);
+                    counter.rotation();
+                }
+                tree_rotate_up(node);
+                counter.rotation();
+            }
+        }
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -97,7 +97,11 @@ namespace ft
 
         tree_iterator &operator++()
         {
+#ifdef FT_TREE_THREADED
+            ptr = ptr->next;
+#else
             ptr = tree_iter_next<end_node_pointer>(static_cast<node_pointer>(ptr));
+#endif
             return *this;
         }
 
@@ -110,7 +114,11 @@ namespace ft
 
         tree_iterator &operator--()
         {
+#ifdef FT_TREE_THREADED
+            ptr = ptr->prev;
+#else
             ptr = tree_iter_prev<node_pointer>(ptr);
+#endif
             return *this;
         }
 
@@ -210,7 +218,11 @@ namespace ft
 
         const_tree_iterator &operator++()
         {
+#ifdef FT_TREE_THREADED
+            ptr = ptr->next;
+#else
             ptr = tree_iter_next<end_node_pointer>(static_cast<node_pointer>(ptr));
+#endif
             return *this;
         }
 
@@ -223,7 +235,11 @@ namespace ft
 
         const_tree_iterator &operator--()
         {
+#ifdef FT_TREE_THREADED
+            ptr = ptr->prev;
+#else
             ptr = tree_iter_prev<node_pointer>(ptr);
+#endif
             return *this;
         }
 
@@ -23,6 +23,9 @@ namespace ft
     template <typename T>
     class tree_node;
 
+    // Grants the algorithms outside the containers (parallel traversal, ...) access to the nodes
+    struct tree_access;
+
     template <typename T>
     struct tree_node_types
     {
@@ -32,19 +35,35 @@ namespace ft
         typedef node_type *node_pointer; // normal node pointer
     };
 
+    /**
+     * @brief Building with FT_TREE_THREADED defined gives every node (and the end node) links to
+     * its in-order neighbours, kept as a circular list through the end node. Iterators then move
+     * with a single pointer load instead of climbing parents, for two more pointers per node.
+     */
     template <typename T>
     class tree_end_node
     {
     public:
         typedef typename tree_node_types<T>::node_pointer node_pointer;
+        typedef typename tree_node_types<T>::end_node_pointer end_node_pointer;
 
     public:
         node_pointer left;
+#ifdef FT_TREE_THREADED
+        end_node_pointer next; // In-order successor
+        end_node_pointer prev; // In-order predecessor
+#endif
 
     public:
+#ifdef FT_TREE_THREADED
+        tree_end_node() : left(NULL), next(this), prev(this)
+        {
+        }
+#else
         tree_end_node() : left(NULL)
         {
         }
+#endif
     };
 
     template <typename T>
@@ -57,14 +76,16 @@ namespace ft
     public:
         node_pointer right;      // Right leaf
         end_node_pointer parent; // Parent node
-        bool is_black;           // Not used (bonus)
+        bool is_black;           // Red-black color
+        int balance;             // Data of the other balancing policies: AVL height, treap priority
         T value;                 // Value of node
 
     public:
         tree_node()
             : right(NULL),
               parent(NULL),
-              is_black(false)
+              is_black(false),
+              balance(0)
         {
         }
 
@@ -111,6 +111,38 @@ namespace ft
     {
     };
 
+    // True when T declares a nested `is_transparent` type (heterogeneous lookup)
+    template <typename T>
+    struct has_is_transparent
+    {
+    private:
+        typedef char yes;
+        typedef char (&no)[2];
+
+        template <typename U>
+        static yes test(typename U::is_transparent *);
+
+        template <typename U>
+        static no test(...);
+
+    public:
+        static const bool value = sizeof(test<T>(0)) == sizeof(yes);
+    };
+
+    // True when T can be copied byte by byte (binary snapshots); C++98 leaves this to the compiler
+    template <typename T>
+    struct is_trivially_copyable
+    {
+        static const bool value = __is_trivially_copyable(T);
+    };
+
+    // True when destroying a T runs no code (containers on arenas can skip the destructor calls)
+    template <typename T>
+    struct is_trivially_destructible
+    {
+        static const bool value = __has_trivial_destructor(T);
+    };
+
 } // namespace ft
 
 #endif
\ No newline at end of file
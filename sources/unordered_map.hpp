@@ -0,0 +1,349 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_map.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:14:53 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 12:14:53 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef UNORDERED_MAP_HPP
+# define UNORDERED_MAP_HPP
+
+# include <functional>
+# include <memory>
+# include <stdexcept>
+
+# include "hash.hpp"
+# include "hash_table.hpp"
+# include "polymorphic_allocator.hpp"
+
+/**
+ * @brief Unordered maps are associative containers that store key-value pairs without any order.
+ * Lookup, insertion and removal are average constant time. This one is a flat open-addressing
+ * table (see hash_table.hpp): it is much faster than ft::map for point lookups, but erase moves
+ * elements around and invalidates all iterators.
+ *
+ * With a transparent Hash and KeyEqual (both declaring `is_transparent`, e.g. ft::string_hash and
+ * ft::transparent_equal_to) find/count/contains/at also accept other types than key_type.
+ *
+ * @link https://en.cppreference.com/w/cpp/container/unordered_map @endlink
+ * @link https://cplusplus.com/reference/unordered_map/unordered_map/ @endlink
+ */
+
+namespace ft
+{
+    template <typename Key, typename T, typename Hash = ft::hash<Key>,
+              typename KeyEqual = std::equal_to<Key>,
+              typename Allocator = std::allocator<pair<const Key, T> > >
+    class unordered_map
+    {
+    public:
+        typedef Key                                      key_type;
+        typedef T                                        mapped_type;
+        typedef pair<const key_type, mapped_type>        value_type;
+        typedef Hash                                     hasher;
+        typedef KeyEqual                                 key_equal;
+        typedef Allocator                                allocator_type;
+        typedef typename allocator_type::size_type       size_type;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef value_type&                              reference;
+        typedef const value_type&                        const_reference;
+        typedef typename allocator_type::pointer         pointer;
+        typedef typename allocator_type::const_pointer   const_pointer;
+
+    private:
+        typedef hash_table<value_type, select_first<value_type>, hasher, key_equal, allocator_type> base;
+
+    public:
+        typedef typename base::iterator       iterator;
+        typedef typename base::const_iterator const_iterator;
+
+    private:
+        // Enables the heterogeneous overloads only for transparent functors
+        template <typename K, typename R>
+        struct if_transparent : public enable_if<base::transparent, R>
+        {
+        };
+
+    public:
+        explicit unordered_map(size_type bucket_count = 0, const hasher &hash = hasher(),
+                               const key_equal &equal = key_equal(),
+                               const allocator_type &alloc = allocator_type())
+            : table_(bucket_count, hash, equal, alloc)
+        {
+        }
+
+        template <typename InputIt>
+        unordered_map(InputIt first, InputIt last, size_type bucket_count = 0,
+                      const hasher &hash = hasher(), const key_equal &equal = key_equal(),
+                      const allocator_type &alloc = allocator_type())
+            : table_(bucket_count, hash, equal, alloc)
+        {
+            insert(first, last);
+        }
+
+        unordered_map(const unordered_map &other)
+            : table_(other.table_)
+        {
+        }
+
+        unordered_map &operator=(const unordered_map &other)
+        {
+            table_ = other.table_;
+            return *this;
+        }
+
+        ~unordered_map()
+        {
+        }
+
+    public:
+        allocator_type get_allocator() const
+        {
+            return table_.get_allocator();
+        }
+
+        iterator begin()
+        {
+            return table_.begin();
+        }
+
+        const_iterator begin() const
+        {
+            return table_.begin();
+        }
+
+        iterator end()
+        {
+            return table_.end();
+        }
+
+        const_iterator end() const
+        {
+            return table_.end();
+        }
+
+        bool empty() const
+        {
+            return table_.empty();
+        }
+
+        size_type size() const
+        {
+            return table_.size();
+        }
+
+        size_type max_size() const
+        {
+            return table_.max_size();
+        }
+
+        void clear()
+        {
+            table_.clear();
+        }
+
+        pair<iterator, bool> insert(const value_type &value)
+        {
+            return table_.insert(value);
+        }
+
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            table_.insert(first, last);
+        }
+
+        // Invalidates every iterator, elements after `pos` may be moved back
+        void erase(const_iterator pos)
+        {
+            table_.erase(pos);
+        }
+
+        size_type erase(const key_type &key)
+        {
+            return table_.erase_key(key);
+        }
+
+        void swap(unordered_map &other)
+        {
+            table_.swap(other.table_);
+        }
+
+        T &at(const key_type &key)
+        {
+            iterator it = find(key);
+            if (it == end())
+                throw std::out_of_range("Key not found");
+            return it->second;
+        }
+
+        const T &at(const key_type &key) const
+        {
+            const_iterator it = find(key);
+            if (it == end())
+                throw std::out_of_range("Key not found");
+            return it->second;
+        }
+
+        T &operator[](const key_type &key)
+        {
+            iterator it = table_.find(key);
+            if (it != end())
+                return it->second;
+            return table_.insert(ft::make_pair(key, T())).first->second;
+        }
+
+        size_type count(const key_type &key) const
+        {
+            return table_.count(key);
+        }
+
+        bool contains(const key_type &key) const
+        {
+            return table_.count(key) != 0;
+        }
+
+        iterator find(const key_type &key)
+        {
+            return table_.find(key);
+        }
+
+        const_iterator find(const key_type &key) const
+        {
+            return table_.find(key);
+        }
+
+        template <typename K>
+        typename if_transparent<K, iterator>::type find(const K &key)
+        {
+            return table_.find(key);
+        }
+
+        template <typename K>
+        typename if_transparent<K, const_iterator>::type find(const K &key) const
+        {
+            return table_.find(key);
+        }
+
+        template <typename K>
+        typename if_transparent<K, size_type>::type count(const K &key) const
+        {
+            return table_.count(key);
+        }
+
+        template <typename K>
+        typename if_transparent<K, bool>::type contains(const K &key) const
+        {
+            return table_.count(key) != 0;
+        }
+
+        pair<iterator, iterator> equal_range(const key_type &key)
+        {
+            iterator it = find(key);
+            iterator next = it;
+            if (it != end())
+                ++next;
+            return ft::make_pair(it, next);
+        }
+
+        pair<const_iterator, const_iterator> equal_range(const key_type &key) const
+        {
+            const_iterator it = find(key);
+            const_iterator next = it;
+            if (it != end())
+                ++next;
+            return ft::make_pair(it, next);
+        }
+
+        // Hash policy
+        size_type bucket_count() const
+        {
+            return table_.bucket_count();
+        }
+
+        float load_factor() const
+        {
+            return table_.load_factor();
+        }
+
+        float max_load_factor() const
+        {
+            return table_.max_load_factor();
+        }
+
+        void max_load_factor(float ml)
+        {
+            table_.max_load_factor(ml);
+        }
+
+        void rehash(size_type count)
+        {
+            table_.rehash(count);
+        }
+
+        void reserve(size_type count)
+        {
+            table_.reserve(count);
+        }
+
+        hasher hash_function() const
+        {
+            return table_.hash_function();
+        }
+
+        key_equal key_eq() const
+        {
+            return table_.key_eq();
+        }
+
+    private:
+        base table_;
+    }; // end of unordered_map
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+    inline void swap(unordered_map<Key, T, Hash, KeyEqual, Allocator> &x,
+                     unordered_map<Key, T, Hash, KeyEqual, Allocator> &y)
+    {
+        x.swap(y);
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+    inline bool operator==(const unordered_map<Key, T, Hash, KeyEqual, Allocator> &lhs,
+                           const unordered_map<Key, T, Hash, KeyEqual, Allocator> &rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        typedef typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator iter;
+        for (iter it = lhs.begin(); it != lhs.end(); ++it)
+        {
+            iter found = rhs.find(it->first);
+            if (found == rhs.end() || !(found->second == it->second))
+                return false;
+        }
+        return true;
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+    inline bool operator!=(const unordered_map<Key, T, Hash, KeyEqual, Allocator> &lhs,
+                           const unordered_map<Key, T, Hash, KeyEqual, Allocator> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    namespace pmr
+    {
+        // ft::unordered_map allocating from a memory_resource
+        template <typename Key, typename T, typename Hash = ft::hash<Key>, typename KeyEqual = std::equal_to<Key> >
+        struct unordered_map
+        {
+            typedef ft::unordered_map<Key, T, Hash, KeyEqual, polymorphic_allocator<pair<const Key, T> > > type;
+        };
+    } // namespace pmr
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -0,0 +1,284 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_set.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:40:08 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/18 12:40:08 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef UNORDERED_SET_HPP
+# define UNORDERED_SET_HPP
+
+# include <functional>
+# include <memory>
+
+# include "hash.hpp"
+# include "hash_table.hpp"
+# include "polymorphic_allocator.hpp"
+
+/**
+ * @brief Unordered sets store unique keys without any order, on the same flat table as
+ * ft::unordered_map. Elements are immutable, so both iterator types are constant.
+ *
+ * @link https://en.cppreference.com/w/cpp/container/unordered_set @endlink
+ * @link https://cplusplus.com/reference/unordered_set/unordered_set/ @endlink
+ */
+
+namespace ft
+{
+    template <typename Key, typename Hash = ft::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+              typename Allocator = std::allocator<Key> >
+    class unordered_set
+    {
+    public:
+        typedef Key                                      key_type;
+        typedef Key                                      value_type;
+        typedef Hash                                     hasher;
+        typedef KeyEqual                                 key_equal;
+        typedef Allocator                                allocator_type;
+        typedef typename allocator_type::size_type       size_type;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef value_type&                              reference;
+        typedef const value_type&                        const_reference;
+        typedef typename allocator_type::pointer         pointer;
+        typedef typename allocator_type::const_pointer   const_pointer;
+
+    private:
+        typedef hash_table<value_type, identity<value_type>, hasher, key_equal, allocator_type> base;
+
+    public:
+        typedef typename base::const_iterator iterator;
+        typedef typename base::const_iterator const_iterator;
+
+    private:
+        template <typename K, typename R>
+        struct if_transparent : public enable_if<base::transparent, R>
+        {
+        };
+
+    public:
+        explicit unordered_set(size_type bucket_count = 0, const hasher &hash = hasher(),
+                               const key_equal &equal = key_equal(),
+                               const allocator_type &alloc = allocator_type())
+            : table_(bucket_count, hash, equal, alloc)
+        {
+        }
+
+        template <typename InputIt>
+        unordered_set(InputIt first, InputIt last, size_type bucket_count = 0,
+                      const hasher &hash = hasher(), const key_equal &equal = key_equal(),
+                      const allocator_type &alloc = allocator_type())
+            : table_(bucket_count, hash, equal, alloc)
+        {
+            insert(first, last);
+        }
+
+        unordered_set(const unordered_set &other)
+            : table_(other.table_)
+        {
+        }
+
+        unordered_set &operator=(const unordered_set &other)
+        {
+            table_ = other.table_;
+            return *this;
+        }
+
+        ~unordered_set()
+        {
+        }
+
+    public:
+        allocator_type get_allocator() const
+        {
+            return table_.get_allocator();
+        }
+
+        const_iterator begin() const
+        {
+            return table_.begin();
+        }
+
+        const_iterator end() const
+        {
+            return table_.end();
+        }
+
+        bool empty() const
+        {
+            return table_.empty();
+        }
+
+        size_type size() const
+        {
+            return table_.size();
+        }
+
+        size_type max_size() const
+        {
+            return table_.max_size();
+        }
+
+        void clear()
+        {
+            table_.clear();
+        }
+
+        pair<iterator, bool> insert(const value_type &value)
+        {
+            pair<typename base::iterator, bool> res = table_.insert(value);
+            return ft::make_pair(iterator(res.first), res.second);
+        }
+
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            table_.insert(first, last);
+        }
+
+        // Invalidates every iterator, elements after `pos` may be moved back
+        void erase(const_iterator pos)
+        {
+            table_.erase(pos);
+        }
+
+        size_type erase(const key_type &key)
+        {
+            return table_.erase_key(key);
+        }
+
+        void swap(unordered_set &other)
+        {
+            table_.swap(other.table_);
+        }
+
+        size_type count(const key_type &key) const
+        {
+            return table_.count(key);
+        }
+
+        bool contains(const key_type &key) const
+        {
+            return table_.count(key) != 0;
+        }
+
+        const_iterator find(const key_type &key) const
+        {
+            return table_.find(key);
+        }
+
+        template <typename K>
+        typename if_transparent<K, const_iterator>::type find(const K &key) const
+        {
+            return table_.find(key);
+        }
+
+        template <typename K>
+        typename if_transparent<K, size_type>::type count(const K &key) const
+        {
+            return table_.count(key);
+        }
+
+        template <typename K>
+        typename if_transparent<K, bool>::type contains(const K &key) const
+        {
+            return table_.count(key) != 0;
+        }
+
+        pair<const_iterator, const_iterator> equal_range(const key_type &key) const
+        {
+            const_iterator it = find(key);
+            const_iterator next = it;
+            if (it != end())
+                ++next;
+            return ft::make_pair(it, next);
+        }
+
+        // Hash policy
+        size_type bucket_count() const
+        {
+            return table_.bucket_count();
+        }
+
+        float load_factor() const
+        {
+            return table_.load_factor();
+        }
+
+        float max_load_factor() const
+        {
+            return table_.max_load_factor();
+        }
+
+        void max_load_factor(float ml)
+        {
+            table_.max_load_factor(ml);
+        }
+
+        void rehash(size_type count)
+        {
+            table_.rehash(count);
+        }
+
+        void reserve(size_type count)
+        {
+            table_.reserve(count);
+        }
+
+        hasher hash_function() const
+        {
+            return table_.hash_function();
+        }
+
+        key_equal key_eq() const
+        {
+            return table_.key_eq();
+        }
+
+    private:
+        base table_;
+    }; // end of unordered_set
+
+    template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+    inline void swap(unordered_set<Key, Hash, KeyEqual, Allocator> &x,
+                     unordered_set<Key, Hash, KeyEqual, Allocator> &y)
+    {
+        x.swap(y);
+    }
+
+    template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+    inline bool operator==(const unordered_set<Key, Hash, KeyEqual, Allocator> &lhs,
+                           const unordered_set<Key, Hash, KeyEqual, Allocator> &rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        typedef typename unordered_set<Key, Hash, KeyEqual, Allocator>::const_iterator iter;
+        for (iter it = lhs.begin(); it != lhs.end(); ++it)
+            if (rhs.find(*it) == rhs.end())
+                return false;
+        return true;
+    }
+
+    template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+    inline bool operator!=(const unordered_set<Key, Hash, KeyEqual, Allocator> &lhs,
+                           const unordered_set<Key, Hash, KeyEqual, Allocator> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    namespace pmr
+    {
+        // ft::unordered_set allocating from a memory_resource
+        template <typename Key, typename Hash = ft::hash<Key>, typename KeyEqual = std::equal_to<Key> >
+        struct unordered_set
+        {
+            typedef ft::unordered_set<Key, Hash, KeyEqual, polymorphic_allocator<Key> > type;
+        };
+    } // namespace pmr
+} // namespace ft
+
+#endif
\ No newline at end of file
@@ -57,6 +57,13 @@ namespace ft
 		}
 	};
 
+    // Tag for overloads that accept a range already sorted by key and free of duplicates
+    struct sorted_unique_t
+    {
+    };
+
+    static const sorted_unique_t sorted_unique = sorted_unique_t();
+
     // Operators
     template <typename T1, typename T2>
 	pair<T1, T2> make_pair(T1 x, T2 y)
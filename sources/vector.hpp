@@ -13,6 +13,8 @@
 #ifndef VECTOR_HPP
 # define VECTOR_HPP
 
+# include "allocator_traits.hpp"
+# include "polymorphic_allocator.hpp"
 # include "type_trait.hpp"
 # include "iterator.hpp"
 # include "random_access_iterator.hpp"
@@ -76,19 +78,19 @@ namespace ft
             }
 
             vector(const vector &other)
-                : _alloc(other._alloc),
+                : _alloc(allocator_traits<allocator_type>::select_on_container_copy_construction(other._alloc)),
                 _start(NULL),
                 _end(NULL),
                 _end_cap(NULL)
             {
-                const size_type cap = other.capacity();
-                if (cap == 0)
-                {
-                    return;
-                }
-                _start = _alloc.allocate(cap);
-                _end_cap = _start + cap;
-                _end = construct_range(_start, other._start, other._end);
+                copy_init(other);
+            }
+
+            // Allocator-extended copy: the elements of other, in memory from alloc
+            vector(const vector &other, const allocator_type &alloc)
+                : _alloc(alloc), _start(NULL), _end(NULL), _end_cap(NULL)
+            {
+                copy_init(other);
             }
 
             explicit vector(const Allocator &alloc)
@@ -126,8 +128,23 @@ namespace ft
             }
             vector &operator=(const vector &rhs)
             {
-                if (this != &rhs)
-                    assign(rhs.begin(), rhs.end());
+                if (this == &rhs)
+                    return *this;
+
+                typedef allocator_traits<allocator_type> traits;
+                if (traits::propagate_on_container_copy_assignment::value)
+                {
+                    // Memory of the current allocator goes back to it before it is replaced
+                    if (!traits::equal(_alloc, rhs._alloc))
+                    {
+                        deallocate_vector();
+                        _start = NULL;
+                        _end = NULL;
+                        _end_cap = NULL;
+                    }
+                    _alloc = rhs._alloc;
+                }
+                assign(rhs.begin(), rhs.end());
 
                 return *this;
             }
@@ -135,6 +152,18 @@ namespace ft
         // Private Member Functions
         private:
 
+            void copy_init(const vector &other)
+            {
+                const size_type cap = other.capacity();
+                if (cap == 0)
+                {
+                    return;
+                }
+                _start = _alloc.allocate(cap);
+                _end_cap = _start + cap;
+                _end = construct_range(_start, other._start, other._end);
+            }
+
             // Constructing values between start and end iterators
             template <typename It>
             pointer construct_range(pointer dst, It start, It end)
@@ -180,7 +209,7 @@ namespace ft
                         push_back(*first);
                 else if (first != last)
                 {
-                    vector tmp(first, last);
+                    vector tmp(first, last, _alloc);
                     insert(pos, tmp.begin(), tmp.end());
                 }
             }
@@ -436,8 +465,8 @@ namespace ft
             {
                 if (count > capacity())
                 {
-                    vector tmp(count, value);
-                    tmp.swap(*this);
+                    vector tmp(count, value, _alloc);
+                    tmp.swap_storage(*this);
                 }
                 else if (count > size())
                 {
@@ -586,7 +615,16 @@ namespace ft
                     erase_at_end(_start + count);
             }
 
+            // Allocators are exchanged only when they propagate on swap, see allocator_traits
             void swap(vector &other)
+            {
+                if (allocator_traits<allocator_type>::propagate_on_container_swap::value)
+                    std::swap(_alloc, other._alloc);
+                swap_storage(other);
+            }
+
+        private:
+            void swap_storage(vector &other)
             {
                 std::swap(_start, other._start);
                 std::swap(_end, other._end);
@@ -632,6 +670,22 @@ namespace ft
 	{
 		return !(lhs < rhs);
 	}
+
+	template <typename T, typename Allocator>
+	inline void swap(vector<T, Allocator> &lhs, vector<T, Allocator> &rhs)
+	{
+		lhs.swap(rhs);
+	}
+
+	namespace pmr
+	{
+		// ft::vector allocating from a memory_resource
+		template <typename T>
+		struct vector
+		{
+			typedef ft::vector<T, polymorphic_allocator<T> > type;
+		};
+	} // namespace pmr
 } // namespace ft
 
 #endif
\ No newline at end of file
@@ -0,0 +1,187 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   work_stealing_deque.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:20:14 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 11:20:14 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WORK_STEALING_DEQUE_HPP
+# define WORK_STEALING_DEQUE_HPP
+
+# include <cstddef>
+
+# include "atomic.hpp"
+# include "vector.hpp"
+
+/**
+ * @brief Chase-Lev work-stealing deque. One owner thread pushes and pops at the bottom, like a
+ * stack, without any CAS except when it takes the last element; any number of thieves steal from
+ * the top with one CAS each. A scheduler gives one to every worker: the owner keeps working on
+ * its newest (cache-hot, smallest) tasks while idle threads take the oldest (biggest) ones.
+ *
+ * Elements live in a power-of-two ring that the owner doubles when full. Thieves may still be
+ * reading a replaced ring, so old rings are only freed with the deque.
+ *
+ * T must be a pointer or an integer (the slots are accessed atomically). steal() returning false
+ * means either empty or lost a race with another thief or the owner; callers move on to another
+ * victim.
+ *
+ * @link https://www.dre.vanderbilt.edu/~schmidt/PDF/work-stealing-dequeue.pdf @endlink
+ * @link https://fzn.fr/readings/ppopp13.pdf @endlink
+ */
+
+namespace ft
+{
+    template <typename T>
+    class work_stealing_deque
+    {
+    public:
+        typedef T           value_type;
+        typedef std::size_t size_type;
+
+    private:
+        struct ring
+        {
+            long mask;
+            T *slots;
+
+            explicit ring(long capacity) : mask(capacity - 1), slots(new T[capacity])
+            {
+            }
+
+            ~ring()
+            {
+                delete[] slots;
+            }
+
+            T get(long i) const
+            {
+                return atomic_load_relaxed(&slots[i & mask]);
+            }
+
+            void put(long i, T value)
+            {
+                atomic_store_relaxed(&slots[i & mask], value);
+            }
+        };
+
+    public:
+        explicit work_stealing_deque(size_type capacity = 64)
+            : top_(0), bottom_(0), ring_(NULL)
+        {
+            long rounded = 2;
+            while (size_type(rounded) < capacity)
+                rounded <<= 1;
+            ring_ = new ring(rounded);
+        }
+
+        ~work_stealing_deque()
+        {
+            delete ring_;
+            for (size_type i = 0; i < retired_.size(); ++i)
+                delete retired_[i];
+        }
+
+    public:
+        // Owner only
+        void push(T value)
+        {
+            const long b = atomic_load_relaxed(&bottom_);
+            const long t = atomic_load(&top_);
+            ring *r = atomic_load_relaxed(&ring_);
+            if (b - t > r->mask)
+                r = grow(r, t, b);
+            r->put(b, value);
+            atomic_store(&bottom_, b + 1);
+        }
+
+        // Owner only: the newest element
+        bool pop(T &out)
+        {
+            const long b = atomic_load_relaxed(&bottom_) - 1;
+            ring *r = atomic_load_relaxed(&ring_);
+            atomic_store_relaxed(&bottom_, b);
+            atomic_thread_fence();
+            long t = atomic_load_relaxed(&top_);
+            if (t > b)
+            {
+                atomic_store_relaxed(&bottom_, b + 1);
+                return false;
+            }
+            out = r->get(b);
+            if (t != b)
+                return true;
+            // Last element: a thief may be taking it too, the CAS on top decides
+            const bool won = atomic_compare_exchange_seq_cst(&top_, t, t + 1);
+            atomic_store_relaxed(&bottom_, b + 1);
+            return won;
+        }
+
+        // Any thread: the oldest element
+        bool steal(T &out)
+        {
+            long t = atomic_load(&top_);
+            atomic_thread_fence();
+            const long b = atomic_load(&bottom_);
+            if (t >= b)
+                return false;
+            ring *r = atomic_load(&ring_);
+            const T value = r->get(t);
+            if (!atomic_compare_exchange_seq_cst(&top_, t, t + 1))
+                return false;
+            out = value;
+            return true;
+        }
+
+        // Snapshots: other threads may change them right after
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        size_type size() const
+        {
+            const long b = atomic_load(&bottom_);
+            const long t = atomic_load(&top_);
+            return b > t ? size_type(b - t) : 0;
+        }
+
+    private:
+        work_stealing_deque(const work_stealing_deque &);
+        work_stealing_deque &operator=(const work_stealing_deque &);
+
+        ring *grow(ring *old, long t, long b)
+        {
+            ring *bigger = new ring(2 * (old->mask + 1));
+            for (long i = t; i < b; ++i)
+                bigger->put(i, old->get(i));
+            try
+            {
+                retired_.push_back(old);
+            }
+            catch (...)
+            {
+                delete bigger;
+                throw;
+            }
+            atomic_store(&ring_, bigger);
+            return bigger;
+        }
+
+    private:
+        // top_ is hit by every thief, bottom_ by the owner: one cache line each
+        long top_;
+        char top_pad_[FT_CACHE_LINE_SIZE - sizeof(long)];
+        long bottom_;
+        char bottom_pad_[FT_CACHE_LINE_SIZE - sizeof(long)];
+        ring *ring_;
+        vector<ring *> retired_; // Owner only
+    };
+} // namespace ft
+
+#endif
\ No newline at end of file
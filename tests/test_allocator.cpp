@@ -0,0 +1,354 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_allocator.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:31:08 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 14:31:08 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <new>
+
+#include "map.hpp"
+#include "stack.hpp"
+#include "vector.hpp"
+
+// Copy construction, copy assignment and swap of ft::vector, ft::map and ft::stack with a
+// stateful allocator whose instances never compare equal across arenas: every container must
+// free its memory through the allocator that allocated it, and allocators travel only as
+// propagate_on_container_copy_assignment / _swap and select_on_container_copy_construction say.
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(expr)                                                              \
+    do                                                                           \
+    {                                                                            \
+        if (!(expr))                                                             \
+        {                                                                        \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            ++failures;                                                          \
+        }                                                                        \
+    } while (0)
+
+    // Memory handed out by one counting_allocator; live goes negative when an arena is asked
+    // to free another arena's memory
+    struct arena
+    {
+        long live;
+        long allocations;
+        arena *copies_to; // Where select_on_container_copy_construction sends copies, if set
+
+        arena() : live(0), allocations(0), copies_to(NULL)
+        {
+        }
+    };
+
+    arena default_arena;
+
+    template <bool Propagate>
+    struct propagate_flag
+    {
+        typedef ft::false_type type;
+    };
+
+    template <>
+    struct propagate_flag<true>
+    {
+        typedef ft::true_type type;
+    };
+
+    template <typename T, bool Propagate>
+    class counting_allocator
+    {
+    public:
+        typedef T value_type;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename propagate_flag<Propagate>::type propagate_on_container_copy_assignment;
+        typedef propagate_on_container_copy_assignment propagate_on_container_swap;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef counting_allocator<U, Propagate> other;
+        };
+
+        counting_allocator() : arena_(&default_arena)
+        {
+        }
+
+        explicit counting_allocator(arena *a) : arena_(a)
+        {
+        }
+
+        template <typename U>
+        counting_allocator(const counting_allocator<U, Propagate> &other) : arena_(other.get_arena())
+        {
+        }
+
+        counting_allocator select_on_container_copy_construction() const
+        {
+            return counting_allocator(arena_->copies_to != NULL ? arena_->copies_to : arena_);
+        }
+
+        pointer allocate(size_type n, const void * = 0)
+        {
+            arena_->live += static_cast<long>(n);
+            ++arena_->allocations;
+            return static_cast<pointer>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(pointer p, size_type n)
+        {
+            arena_->live -= static_cast<long>(n);
+            CHECK(arena_->live >= 0);
+            ::operator delete(p);
+        }
+
+        void construct(pointer p, const T &value)
+        {
+            new (p) T(value);
+        }
+
+        void destroy(pointer p)
+        {
+            p->~T();
+        }
+
+        size_type max_size() const
+        {
+            return std::numeric_limits<size_type>::max() / sizeof(T);
+        }
+
+        pointer address(reference x) const
+        {
+            return &x;
+        }
+
+        const_pointer address(const_reference x) const
+        {
+            return &x;
+        }
+
+        arena *get_arena() const
+        {
+            return arena_;
+        }
+
+    private:
+        arena *arena_;
+    };
+
+    template <typename T, typename U, bool P>
+    bool operator==(const counting_allocator<T, P> &lhs, const counting_allocator<U, P> &rhs)
+    {
+        return lhs.get_arena() == rhs.get_arena();
+    }
+
+    template <typename T, typename U, bool P>
+    bool operator!=(const counting_allocator<T, P> &lhs, const counting_allocator<U, P> &rhs)
+    {
+        return lhs.get_arena() != rhs.get_arena();
+    }
+
+    // Uniform access to the three containers: fill, compare contents, read the arena
+    template <bool P>
+    struct vector_case
+    {
+        typedef counting_allocator<int, P> allocator_type;
+        typedef ft::vector<int, allocator_type> container_type;
+
+        static container_type make(arena &a, int first, int count)
+        {
+            container_type c((allocator_type(&a)));
+            for (int i = 0; i < count; ++i)
+                c.push_back(first + i);
+            return c;
+        }
+
+        static bool same(const container_type &lhs, const container_type &rhs)
+        {
+            return lhs == rhs;
+        }
+
+        static arena *arena_of(const container_type &c)
+        {
+            return c.get_allocator().get_arena();
+        }
+    };
+
+    template <bool P>
+    struct map_case
+    {
+        typedef counting_allocator<ft::pair<const int, int>, P> allocator_type;
+        typedef ft::map<int, int, std::less<int>, allocator_type> container_type;
+
+        static container_type make(arena &a, int first, int count)
+        {
+            container_type c((std::less<int>()), allocator_type(&a));
+            for (int i = 0; i < count; ++i)
+                c.insert(ft::make_pair(first + i, i));
+            return c;
+        }
+
+        static bool same(const container_type &lhs, const container_type &rhs)
+        {
+            return lhs == rhs;
+        }
+
+        static arena *arena_of(const container_type &c)
+        {
+            return c.get_allocator().get_arena();
+        }
+    };
+
+    // ft::stack has no get_allocator: the arena is read off a copy of the underlying vector,
+    // taken through the protected member
+    template <bool P>
+    struct stack_case
+    {
+        typedef counting_allocator<int, P> allocator_type;
+        typedef ft::vector<int, allocator_type> underlying_type;
+        typedef ft::stack<int, underlying_type> container_type;
+
+        struct access : public container_type
+        {
+            static const underlying_type &underlying(const container_type &s)
+            {
+                return s.*(&access::c);
+            }
+        };
+
+        static container_type make(arena &a, int first, int count)
+        {
+            container_type c((allocator_type(&a)));
+            for (int i = 0; i < count; ++i)
+                c.push(first + i);
+            return c;
+        }
+
+        static bool same(const container_type &lhs, const container_type &rhs)
+        {
+            return lhs == rhs;
+        }
+
+        static arena *arena_of(const container_type &c)
+        {
+            return access::underlying(c).get_allocator().get_arena();
+        }
+    };
+
+    // The temporaries returned by make are copies too, so every case starts from arenas that
+    // copy to themselves and only then sets copies_to
+    template <typename Case>
+    void test_copy_construction()
+    {
+        typedef typename Case::container_type container_type;
+        arena source;
+        arena target;
+        {
+            const container_type original = Case::make(source, 0, 100);
+            source.copies_to = &target;
+            const container_type copy(original);
+            CHECK(Case::same(copy, original));
+            CHECK(Case::arena_of(copy) == &target);
+            CHECK(target.live > 0);
+        }
+        CHECK(source.live == 0);
+        CHECK(target.live == 0);
+    }
+
+    template <typename Case>
+    void test_copy_assignment(bool propagate)
+    {
+        typedef typename Case::container_type container_type;
+        arena left;
+        arena right;
+        {
+            container_type lhs = Case::make(left, 0, 50);
+            const container_type rhs = Case::make(right, 1000, 200);
+            const long right_before = right.live;
+            lhs = rhs;
+            CHECK(Case::same(lhs, rhs));
+            if (propagate)
+            {
+                CHECK(Case::arena_of(lhs) == &right);
+                CHECK(left.live == 0);
+                CHECK(right.live > right_before);
+            }
+            else
+            {
+                CHECK(Case::arena_of(lhs) == &left);
+                CHECK(left.live > 0);
+                CHECK(right.live == right_before);
+            }
+        }
+        CHECK(left.live == 0);
+        CHECK(right.live == 0);
+    }
+
+    // Swapping with unequal allocators that do not propagate is undefined, so only the
+    // propagating allocator swaps across arenas; the other swaps within one arena
+    template <typename Case>
+    void test_swap(bool propagate)
+    {
+        typedef typename Case::container_type container_type;
+        arena left;
+        arena right;
+        {
+            container_type lhs = Case::make(left, 0, 30);
+            container_type rhs = Case::make(propagate ? right : left, 500, 70);
+            const container_type lhs_copy(lhs);
+            const container_type rhs_copy(rhs);
+            lhs.swap(rhs);
+            CHECK(Case::same(lhs, rhs_copy));
+            CHECK(Case::same(rhs, lhs_copy));
+            CHECK(Case::arena_of(lhs) == (propagate ? &right : &left));
+            CHECK(Case::arena_of(rhs) == &left);
+            ft::swap(lhs, rhs);
+            CHECK(Case::same(lhs, lhs_copy));
+            CHECK(Case::arena_of(lhs) == &left);
+        }
+        CHECK(left.live == 0);
+        CHECK(right.live == 0);
+    }
+
+    template <template <bool> class Case>
+    void test_container()
+    {
+        test_copy_construction<Case<false> >();
+        test_copy_construction<Case<true> >();
+        test_copy_assignment<Case<false> >(false);
+        test_copy_assignment<Case<true> >(true);
+        test_swap<Case<false> >(false);
+        test_swap<Case<true> >(true);
+    }
+}
+
+int main()
+{
+    test_container<vector_case>();
+    test_container<map_case>();
+    test_container<stack_case>();
+    CHECK(default_arena.live == 0);
+    if (failures != 0)
+    {
+        std::printf("test_allocator: %d failures\n", failures);
+        return 1;
+    }
+    std::printf("test_allocator: ok\n");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_reverse_iterator.cpp                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:41:26 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 17:41:26 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+
+#include "flat_map.hpp"
+#include "map.hpp"
+#include "static_map.hpp"
+#include "vector.hpp"
+
+// ft::reverse_iterator::operator-> over iterators whose reference is a proxy (ft::flat_map,
+// ft::static_map) as well as over real references (ft::map, ft::vector) and raw pointers.
+// `rbegin()->first` must compile for all of them and name the last element.
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(expr)                                                              \
+    do                                                                           \
+    {                                                                            \
+        if (!(expr))                                                             \
+        {                                                                        \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            ++failures;                                                          \
+        }                                                                        \
+    } while (0)
+
+    struct point
+    {
+        int x;
+        int y;
+    };
+
+    void test_flat_map()
+    {
+        ft::flat_map<int, int> m;
+        for (int i = 0; i < 10; ++i)
+            m.insert(ft::make_pair(i, i * 10));
+        CHECK(m.rbegin()->first == 9);
+        CHECK(m.rbegin()->second == 90);
+        m.rbegin()->second = 91;
+        CHECK(m[9] == 91);
+
+        const ft::flat_map<int, int> &cm = m;
+        ft::flat_map<int, int>::const_reverse_iterator it = cm.rbegin();
+        ++it;
+        CHECK(it->first == 8);
+        CHECK(it->second == 80);
+    }
+
+    void test_static_map()
+    {
+        ft::map<int, int> source;
+        for (int i = 0; i < 10; ++i)
+            source.insert(ft::make_pair(i, i * 10));
+        const ft::static_map<int, int> m(source);
+        CHECK(m.rbegin()->first == 9);
+        CHECK(m.rbegin()->second == 90);
+        ft::static_map<int, int>::const_reverse_iterator it = m.rbegin();
+        ++it;
+        CHECK(it->first == 8);
+    }
+
+    void test_references()
+    {
+        ft::map<int, int> m;
+        m.insert(ft::make_pair(1, 10));
+        m.insert(ft::make_pair(2, 20));
+        CHECK(m.rbegin()->first == 2);
+        m.rbegin()->second = 21;
+        CHECK(m[2] == 21);
+
+        ft::vector<point> v;
+        const point p = {1, 2};
+        v.push_back(p);
+        CHECK(v.rbegin()->y == 2);
+
+        point raw[2] = {{1, 2}, {3, 4}};
+        ft::reverse_iterator<point *> last(raw + 2);
+        CHECK(last->x == 3);
+    }
+}
+
+int main()
+{
+    test_flat_map();
+    test_static_map();
+    test_references();
+    if (failures != 0)
+    {
+        std::printf("test_reverse_iterator: %d failures\n", failures);
+        return 1;
+    }
+    std::printf("test_reverse_iterator: ok\n");
+    return 0;
+}
\ No newline at end of file
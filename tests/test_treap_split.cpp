@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_treap_split.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: aabduvak <aabduvak@42ISTANBUL.COM.TR>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:04:52 by aabduvak          #+#    #+#             */
+/*   Updated: 2026/10/19 17:04:52 by aabduvak         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <cstdio>
+#include <functional>
+#include <map>
+
+#include "map.hpp"
+
+// map::split and map::join with Balance = treap_balance, checked against std::map: random
+// splits and joins, joins whose keys overlap (the insert fallback), compacted maps (the copy
+// fallback), Bloom filters on both sides, and splitting or joining a map with itself.
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(expr)                                                              \
+    do                                                                           \
+    {                                                                            \
+        if (!(expr))                                                             \
+        {                                                                        \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+            ++failures;                                                          \
+        }                                                                        \
+    } while (0)
+
+    typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+                    ft::treap_balance> treap_map;
+    typedef std::map<int, int> reference_map;
+
+    // Same keys in both directions, and every key found through find (so through the filter)
+    bool same(const treap_map &m, const reference_map &ref)
+    {
+        if (m.size() != ref.size())
+            return false;
+        reference_map::const_iterator r = ref.begin();
+        for (treap_map::const_iterator it = m.begin(); it != m.end(); ++it, ++r)
+            if (it->first != r->first || it->second != r->second || m.count(r->first) != 1)
+                return false;
+        reference_map::const_reverse_iterator rr = ref.rbegin();
+        for (treap_map::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it, ++rr)
+            if (it->first != rr->first)
+                return false;
+        return true;
+    }
+
+    unsigned int next_random(unsigned int &state)
+    {
+        state = state * 1103515245u + 12345u;
+        return state >> 8;
+    }
+
+    void test_random_rounds()
+    {
+        unsigned int state = 3;
+        for (int round = 0; round < 300; ++round)
+        {
+            treap_map lower;
+            treap_map greater;
+            reference_map ref_lower;
+            reference_map ref_greater;
+
+            const int count = static_cast<int>(next_random(state) % 300);
+            for (int i = 0; i < count; ++i)
+            {
+                const int key = static_cast<int>(next_random(state) % 1000);
+                lower.insert(ft::make_pair(key, i));
+                ref_lower.insert(std::make_pair(key, i));
+            }
+            if (round % 3 == 0)
+                lower.enable_bloom_filter();
+            if (round % 5 == 0)
+                greater.insert(ft::make_pair(5, 5)); // Destroyed by the split
+            if (round % 7 == 0)
+                lower.compact();
+
+            const int key = static_cast<int>(next_random(state) % 1100) - 50;
+            lower.split(key, greater);
+            ref_greater.clear();
+            ref_greater.insert(ref_lower.lower_bound(key), ref_lower.end());
+            ref_lower.erase(ref_lower.lower_bound(key), ref_lower.end());
+            CHECK(same(lower, ref_lower));
+            CHECK(same(greater, ref_greater));
+
+            if (round % 4 == 0)
+            {
+                greater.insert(ft::make_pair(-100, 1)); // Overlaps: join inserts one by one
+                ref_greater.insert(std::make_pair(-100, 1));
+            }
+            lower.join(greater);
+            ref_lower.insert(ref_greater.begin(), ref_greater.end());
+            CHECK(same(lower, ref_lower));
+            CHECK(greater.empty());
+        }
+    }
+
+    void test_self()
+    {
+        treap_map m;
+        for (int i = 0; i < 100; ++i)
+            m.insert(ft::make_pair(i, i));
+        m.enable_bloom_filter();
+
+        m.split(50, m);
+        CHECK(m.size() == 100);
+        m.join(m);
+        CHECK(m.size() == 100);
+        for (int i = 0; i < 100; ++i)
+            CHECK(m.count(i) == 1);
+    }
+}
+
+int main()
+{
+    test_random_rounds();
+    test_self();
+    if (failures != 0)
+    {
+        std::printf("test_treap_split: %d failures\n", failures);
+        return 1;
+    }
+    std::printf("test_treap_split: ok\n");
+    return 0;
+}
\ No newline at end of file